@@ -0,0 +1,83 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+
+// Фоновый поток, выполняющий отложенное освобождение памяти.
+// Владелец структуры данных передаёт ему отцепленные узлы (SingleLinkedList::ClearDeferred)
+// и сразу продолжает работу, а разрушение элементов происходит в потоке reclaimer-а.
+// Деструктор дожидается выполнения всех переданных задач
+class BackgroundReclaimer {
+public:
+    BackgroundReclaimer()
+        : worker_([this] {
+            Run();
+        }) {
+    }
+
+    BackgroundReclaimer(const BackgroundReclaimer&) = delete;
+    BackgroundReclaimer& operator=(const BackgroundReclaimer&) = delete;
+
+    ~BackgroundReclaimer() {
+        {
+            std::lock_guard guard(mutex_);
+            stopping_ = true;
+        }
+        has_work_.notify_one();
+        worker_.join();
+    }
+
+    void Submit(std::function<void()> task) {
+        {
+            std::lock_guard guard(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+        has_work_.notify_one();
+    }
+
+    // Блокирует вызывающий поток, пока не будут выполнены все переданные задачи
+    void Wait() {
+        std::unique_lock lock(mutex_);
+        idle_.wait(lock, [this] {
+            return tasks_.empty() && !busy_;
+        });
+    }
+
+private:
+    void Run() {
+        std::unique_lock lock(mutex_);
+        while (true) {
+            has_work_.wait(lock, [this] {
+                return stopping_ || !tasks_.empty();
+            });
+            if (tasks_.empty()) {
+                return;
+            }
+            std::function<void()> task = std::move(tasks_.front());
+            tasks_.pop_front();
+            busy_ = true;
+            lock.unlock();
+            task();
+            task = nullptr;
+            lock.lock();
+            busy_ = false;
+            if (tasks_.empty()) {
+                idle_.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable has_work_;
+    std::condition_variable idle_;
+    std::deque<std::function<void()>> tasks_;
+    bool busy_ = false;
+    bool stopping_ = false;
+    // Поток объявлен последним, чтобы запускаться после инициализации остальных полей
+    std::thread worker_;
+};
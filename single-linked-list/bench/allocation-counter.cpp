@@ -0,0 +1,85 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "bench/bench.h"
+
+// Замещение глобальных operator new/delete, подсчитывающее выделения памяти для отчёта замеров
+
+namespace {
+
+std::atomic<std::size_t> allocation_count{0};
+std::atomic<std::size_t> allocated_bytes{0};
+
+void* CountedAllocate(std::size_t size, std::size_t alignment) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    void* ptr = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+        ptr = std::malloc(size);
+    } else {
+        size = (size + alignment - 1) / alignment * alignment;
+        ptr = std::aligned_alloc(alignment, size);
+    }
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+}  // namespace
+
+AllocationStats GetAllocationStats() noexcept {
+    return {allocation_count.load(std::memory_order_relaxed), allocated_bytes.load(std::memory_order_relaxed)};
+}
+
+void* operator new(std::size_t size) {
+    return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size) {
+    return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
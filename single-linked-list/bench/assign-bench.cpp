@@ -0,0 +1,44 @@
+#include <numeric>
+#include <vector>
+
+#include "bench/bench.h"
+#include "single-linked-list.h"
+
+namespace {
+
+// Многократное присваивание спискам того же размера и на 10% короче/длиннее
+void Assign(const BenchmarkOptions& options) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        std::vector<int> values(size);
+        std::iota(values.begin(), values.end(), 0);
+        const SingleLinkedList<int> same(values.begin(), values.end());
+        const SingleLinkedList<int> shorter(values.begin(), values.begin() + size * 9 / 10);
+        SingleLinkedList<int> target(values.begin(), values.end());
+
+        // Прежнее присваивание: копия во временный список и обмен
+        ReportBenchmark("Reassign<CopyAndSwap>", size, Measure(options, size, [&] {
+            SingleLinkedList<int> temp(same);
+            target.swap(temp);
+        }));
+        ReportBenchmark("Reassign<operator=>", size, Measure(options, size, [&] {
+            target = same;
+        }));
+        ReportBenchmark("Reassign<Assign(vector)>", size, Measure(options, size, [&] {
+            target.Assign(values.begin(), values.end());
+        }));
+        ReportBenchmark("ReassignAlternatingLength<CopyAndSwap>", size, Measure(options, size * 2, [&] {
+            SingleLinkedList<int> temp(shorter);
+            target.swap(temp);
+            SingleLinkedList<int> temp2(same);
+            target.swap(temp2);
+        }));
+        ReportBenchmark("ReassignAlternatingLength<operator=>", size, Measure(options, size * 2, [&] {
+            target = shorter;
+            target = same;
+        }));
+    }
+}
+
+BenchmarkRegistrar assign("Assign", Assign);
+
+}  // namespace
@@ -0,0 +1,108 @@
+#include <malloc.h>
+
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "node-pool.h"
+#include "single-linked-list.h"
+
+namespace {
+
+// Удаления оставляют освобождённые узлы в куче вперемешку, и следующий список, собранный из них,
+// обходится с промахами кеша. Чтобы результат не зависел от порядка замеров,
+// перед каждым построением списка освобождённые блоки malloc объединяются
+void CompactHeap() {
+    malloc_trim(0);
+}
+
+template <typename List>
+void RunBatch(const BenchmarkOptions& options, const std::string& name, List& list) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        std::vector<int> values(size);
+        std::iota(values.begin(), values.end(), 0);
+        const auto clear = [&] {
+            list.Clear();
+            CompactHeap();
+        };
+        const auto fill = [&] {
+            list.Clear();
+            CompactHeap();
+            list.InsertAfter(list.cbefore_begin(), values.begin(), values.end());
+        };
+        // Каждое значение повторяется дважды подряд
+        const auto fill_pairs = [&] {
+            list.Clear();
+            CompactHeap();
+            auto pos = list.cbefore_begin();
+            for (int value : values) {
+                pos = list.InsertAfter(pos, value / 2);
+            }
+        };
+
+        ReportBenchmark("InsertRange<" + name + ",Loop>", size, Measure(options, size, clear, [&] {
+            auto pos = list.cbefore_begin();
+            for (int value : values) {
+                pos = list.InsertAfter(pos, value);
+            }
+        }));
+        ReportBenchmark("InsertRange<" + name + ",Batch>", size, Measure(options, size, clear, [&] {
+            list.InsertAfter(list.cbefore_begin(), values.begin(), values.end());
+        }));
+
+        ReportBenchmark("EraseRange<" + name + ",Loop>", size, Measure(options, size, fill, [&] {
+            while (std::next(list.cbegin()) != list.cend()) {
+                list.EraseAfter(list.cbegin());
+            }
+        }));
+        ReportBenchmark("EraseRange<" + name + ",Batch>", size, Measure(options, size, fill, [&] {
+            list.EraseAfter(list.cbegin(), list.cend());
+        }));
+
+        // Удаляется каждый второй элемент
+        ReportBenchmark("RemoveIf<" + name + ",Loop>", size, Measure(options, size, fill, [&] {
+            auto prev = list.cbefore_begin();
+            for (auto it = list.cbegin(); it != list.cend(); it = std::next(prev)) {
+                if (*it % 2 != 0) {
+                    list.EraseAfter(prev);
+                } else {
+                    prev = it;
+                }
+            }
+        }));
+        ReportBenchmark("RemoveIf<" + name + ",Batch>", size, Measure(options, size, fill, [&] {
+            DoNotOptimize(list.RemoveIf([](int value) {
+                return value % 2 != 0;
+            }));
+        }));
+
+        ReportBenchmark("Unique<" + name + ",Loop>", size, Measure(options, size, fill_pairs, [&] {
+            auto kept = list.cbegin();
+            while (std::next(kept) != list.cend()) {
+                if (*std::next(kept) == *kept) {
+                    list.EraseAfter(kept);
+                } else {
+                    ++kept;
+                }
+            }
+        }));
+        ReportBenchmark("Unique<" + name + ",Batch>", size, Measure(options, size, fill_pairs, [&] {
+            DoNotOptimize(list.Unique());
+        }));
+    }
+}
+
+void Batch(const BenchmarkOptions& options) {
+    SingleLinkedList<int> list;
+    RunBatch(options, "SingleLinkedList", list);
+
+    PoolAllocator<int> alloc;
+    SingleLinkedList<int, PoolAllocator<int>> pooled(alloc);
+    RunBatch(options, "SingleLinkedList,NodePool", pooled);
+}
+
+BenchmarkRegistrar batch("Batch", Batch);
+
+}  // namespace
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+// Параметры запуска замеров
+struct BenchmarkOptions {
+    // Максимальное количество элементов, с которым запускаются замеры
+    std::size_t max_size = 100'000;
+    // Количество повторов; в отчёт попадает лучший результат
+    int repetitions = 3;
+};
+
+using BenchmarkFunction = std::function<void(const BenchmarkOptions&)>;
+
+// Реестр замеров. Каждый файл с замерами регистрирует свои функции
+// через статический объект BenchmarkRegistrar
+inline std::vector<std::pair<std::string, BenchmarkFunction>>& GetBenchmarks() {
+    static std::vector<std::pair<std::string, BenchmarkFunction>> benchmarks;
+    return benchmarks;
+}
+
+struct BenchmarkRegistrar {
+    BenchmarkRegistrar(std::string name, BenchmarkFunction function) {
+        GetBenchmarks().emplace_back(std::move(name), std::move(function));
+    }
+};
+
+// Не даёт компилятору выбросить вычисление значения value
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Суммарные выделения памяти через operator new с начала работы программы.
+// Счётчики ведёт замещённый глобальный operator new (bench/allocation-counter.cpp)
+struct AllocationStats {
+    std::size_t count = 0;
+    std::size_t bytes = 0;
+};
+
+AllocationStats GetAllocationStats() noexcept;
+
+// Аппаратный счётчик промахов кэша текущего потока (perf_event_open в Linux).
+// Если счётчик недоступен, IsAvailable() возвращает false
+class CacheMissCounter {
+public:
+    CacheMissCounter();
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+    ~CacheMissCounter();
+
+    [[nodiscard]] bool IsAvailable() const noexcept {
+        return fd_ >= 0;
+    }
+
+    void Start() noexcept;
+    // Останавливает счётчик и возвращает число промахов с момента Start()
+    std::size_t Stop() noexcept;
+
+private:
+    int fd_ = -1;
+};
+
+struct BenchmarkResult {
+    double ns_per_op = 0;
+    double bytes_per_op = 0;
+    // Отрицательное значение означает, что счётчик промахов кэша недоступен
+    double cache_misses_per_op = -1;
+};
+
+// Запускает body заданное количество раз и возвращает результат лучшего по времени повтора
+// в пересчёте на одну из ops операций.
+// setup вызывается перед каждым повтором и в замер не входит
+template <typename Setup, typename Body>
+BenchmarkResult Measure(const BenchmarkOptions& options, std::size_t ops, Setup&& setup, Body&& body) {
+    const double divisor = static_cast<double>(ops == 0 ? 1 : ops);
+    CacheMissCounter cache_misses;
+    BenchmarkResult best;
+    for (int i = 0; i < options.repetitions; ++i) {
+        setup();
+        const AllocationStats allocations_before = GetAllocationStats();
+        cache_misses.Start();
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const auto finish = std::chrono::steady_clock::now();
+        const std::size_t misses = cache_misses.Stop();
+        const AllocationStats allocations_after = GetAllocationStats();
+
+        const double ns = std::chrono::duration<double, std::nano>(finish - start).count() / divisor;
+        if (i == 0 || ns < best.ns_per_op) {
+            best.ns_per_op = ns;
+            best.bytes_per_op = (allocations_after.bytes - allocations_before.bytes) / divisor;
+            best.cache_misses_per_op = cache_misses.IsAvailable() ? misses / divisor : -1;
+        }
+    }
+    return best;
+}
+
+template <typename Body>
+BenchmarkResult Measure(const BenchmarkOptions& options, std::size_t ops, Body&& body) {
+    return Measure(options, ops, [] {}, std::forward<Body>(body));
+}
+
+// Упрощённые варианты Measure, возвращающие только время одной операции
+template <typename Setup, typename Body>
+double MeasureNsPerOp(const BenchmarkOptions& options, std::size_t ops, Setup&& setup, Body&& body) {
+    return Measure(options, ops, std::forward<Setup>(setup), std::forward<Body>(body)).ns_per_op;
+}
+
+template <typename Body>
+double MeasureNsPerOp(const BenchmarkOptions& options, std::size_t ops, Body&& body) {
+    return MeasureNsPerOp(options, ops, [] {}, std::forward<Body>(body));
+}
+
+inline void ReportBenchmark(const std::string& name, std::size_t size, double ns_per_op) {
+    std::cout << name << "/" << size << "\t" << ns_per_op << " ns/op" << std::endl;
+}
+
+inline void ReportBenchmark(const std::string& name, std::size_t size, const BenchmarkResult& result) {
+    std::cout << name << "/" << size << "\t" << result.ns_per_op << " ns/op\t" << result.bytes_per_op << " B/op";
+    if (result.cache_misses_per_op >= 0) {
+        std::cout << "\t" << result.cache_misses_per_op << " misses/op";
+    }
+    std::cout << std::endl;
+}
+
+// Размеры 10^2, 10^3, ... не превышающие options.max_size
+inline std::vector<std::size_t> BenchmarkSizes(const BenchmarkOptions& options) {
+    std::vector<std::size_t> sizes;
+    for (std::size_t size = 100; size <= options.max_size; size *= 10) {
+        sizes.push_back(size);
+    }
+    return sizes;
+}
@@ -0,0 +1,61 @@
+#include "bench/bench.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+
+CacheMissCounter::CacheMissCounter() {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+CacheMissCounter::~CacheMissCounter() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+void CacheMissCounter::Start() noexcept {
+    if (fd_ >= 0) {
+        ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+std::size_t CacheMissCounter::Stop() noexcept {
+    if (fd_ < 0) {
+        return 0;
+    }
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+    long long count = 0;
+    if (read(fd_, &count, sizeof(count)) != sizeof(count)) {
+        return 0;
+    }
+    return static_cast<std::size_t>(count);
+}
+
+#else
+
+CacheMissCounter::CacheMissCounter() = default;
+
+CacheMissCounter::~CacheMissCounter() = default;
+
+void CacheMissCounter::Start() noexcept {
+}
+
+std::size_t CacheMissCounter::Stop() noexcept {
+    return 0;
+}
+
+#endif
@@ -0,0 +1,65 @@
+#include <string>
+#include <vector>
+
+#include "background-reclaimer.h"
+#include "bench/bench.h"
+#include "node-pool.h"
+#include "single-linked-list.h"
+
+namespace {
+
+template <typename List>
+void Fill(List& list, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        list.PushFront(static_cast<typename List::value_type>(i));
+    }
+}
+
+// Время, за которое владелец списка освобождается от size элементов
+void Clear(const BenchmarkOptions& options) {
+    BackgroundReclaimer reclaimer;
+    for (std::size_t size : BenchmarkSizes(options)) {
+        {
+            // Прежняя реализация Clear: EraseAfter(before_begin()) для каждого узла
+            SingleLinkedList<int> list;
+            ReportBenchmark("Clear<EraseAfterLoop>", size, MeasureNsPerOp(options, size, [&] {
+                Fill(list, size);
+            }, [&] {
+                while (!list.IsEmpty()) {
+                    list.EraseAfter(list.cbefore_begin());
+                }
+            }));
+            ReportBenchmark("Clear<Bulk>", size, MeasureNsPerOp(options, size, [&] {
+                Fill(list, size);
+            }, [&] {
+                list.Clear();
+            }));
+            ReportBenchmark("Clear<Deferred>", size, MeasureNsPerOp(options, size, [&] {
+                reclaimer.Wait();
+                Fill(list, size);
+            }, [&] {
+                list.ClearDeferred(reclaimer);
+            }));
+            reclaimer.Wait();
+        }
+        {
+            SingleLinkedList<int, PoolAllocator<int>> list;
+            ReportBenchmark("Clear<NodePool,EraseAfterLoop>", size, MeasureNsPerOp(options, size, [&] {
+                Fill(list, size);
+            }, [&] {
+                while (!list.IsEmpty()) {
+                    list.EraseAfter(list.cbefore_begin());
+                }
+            }));
+            ReportBenchmark("Clear<NodePool,ReleaseBlocks>", size, MeasureNsPerOp(options, size, [&] {
+                Fill(list, size);
+            }, [&] {
+                list.Clear();
+            }));
+        }
+    }
+}
+
+BenchmarkRegistrar clear("Clear", Clear);
+
+}  // namespace
@@ -0,0 +1,82 @@
+#include <malloc.h>
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "bench/bench.h"
+#include "compact-single-linked-list.h"
+#include "single-linked-list.h"
+
+namespace {
+
+struct Pod16 {
+    int a = 0;
+    int b = 0;
+    int c = 0;
+    int d = 0;
+};
+
+int Key(int value) {
+    return value;
+}
+
+int Key(const std::pair<int, int>& value) {
+    return value.first;
+}
+
+int Key(const Pod16& value) {
+    return value.a;
+}
+
+template <typename Type>
+Type MakeValue(int i) {
+    if constexpr (std::is_same_v<Type, int>) {
+        return i;
+    } else if constexpr (std::is_same_v<Type, std::pair<int, int>>) {
+        return {i, i};
+    } else {
+        return Pod16{i, i, i, i};
+    }
+}
+
+// Память, занятая в куче с учётом служебных заголовков malloc и блоков, выделенных через mmap
+std::size_t HeapInUse() {
+    const struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+template <typename List>
+void RunLayout(const BenchmarkOptions& options, const std::string& name) {
+    using Type = typename List::value_type;
+    for (std::size_t size : BenchmarkSizes(options)) {
+        const std::size_t before = HeapInUse();
+        List list;
+        for (std::size_t i = 0; i < size; ++i) {
+            list.PushFront(MakeValue<Type>(static_cast<int>(i)));
+        }
+        const double bytes_per_element = static_cast<double>(HeapInUse() - before) / size;
+        std::cout << "LayoutMemory<" << name << ">/" << size << "\t" << bytes_per_element << " B/element" << std::endl;
+
+        ReportBenchmark("LayoutScan<" + name + ">", size, Measure(options, size, [&] {
+            long long sum = 0;
+            for (const Type& value : list) {
+                sum += Key(value);
+            }
+            DoNotOptimize(sum);
+        }));
+    }
+}
+
+void Layout(const BenchmarkOptions& options) {
+    RunLayout<SingleLinkedList<int>>(options, "SingleLinkedList,int");
+    RunLayout<CompactSingleLinkedList<int>>(options, "Compact,int");
+    RunLayout<SingleLinkedList<std::pair<int, int>>>(options, "SingleLinkedList,pair<int,int>");
+    RunLayout<CompactSingleLinkedList<std::pair<int, int>>>(options, "Compact,pair<int,int>");
+    RunLayout<SingleLinkedList<Pod16>>(options, "SingleLinkedList,Pod16");
+    RunLayout<CompactSingleLinkedList<Pod16>>(options, "Compact,Pod16");
+}
+
+BenchmarkRegistrar layout("Layout", Layout);
+
+}  // namespace
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench/bench.h"
+#include "concurrent-single-linked-list.h"
+#include "single-linked-list.h"
+
+namespace {
+
+// SingleLinkedList, защищённый мьютексом: то, чем приходится пользоваться без неблокирующего варианта
+template <typename Type>
+class MutexSingleLinkedList {
+public:
+    void PushFront(const Type& value) {
+        std::lock_guard guard(mutex_);
+        list_.PushFront(value);
+    }
+
+    bool TryPopFront(Type& value) {
+        std::lock_guard guard(mutex_);
+        if (list_.IsEmpty()) {
+            return false;
+        }
+        value = *list_.begin();
+        list_.PopFront();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    SingleLinkedList<Type> list_;
+};
+
+// Каждый поток выполняет ops_per_thread пар PushFront/TryPopFront над общим списком.
+// Возвращает время в наносекундах на одну операцию в пересчёте на все потоки
+template <typename List>
+double RunPushPop(std::size_t thread_count, std::size_t ops_per_thread) {
+    List list;
+    std::atomic<bool> start = false;
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&] {
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            int value = 0;
+            for (std::size_t i = 0; i < ops_per_thread; ++i) {
+                list.PushFront(static_cast<int>(i));
+                list.TryPopFront(value);
+            }
+            DoNotOptimize(value);
+        });
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / (2.0 * thread_count * ops_per_thread);
+}
+
+template <typename List>
+void RunScaling(const BenchmarkOptions& options, const std::string& name) {
+    const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        double best = 0;
+        for (int i = 0; i < options.repetitions; ++i) {
+            const double ns = RunPushPop<List>(threads, options.max_size);
+            best = (i == 0 || ns < best) ? ns : best;
+        }
+        ReportBenchmark(name + "/threads:" + std::to_string(threads), options.max_size, best);
+    }
+}
+
+void ConcurrentPushPop(const BenchmarkOptions& options) {
+    RunScaling<ConcurrentSingleLinkedList<int>>(options, "ConcurrentPushPop<HazardPointers>");
+    RunScaling<MutexSingleLinkedList<int>>(options, "ConcurrentPushPop<Mutex>");
+}
+
+BenchmarkRegistrar concurrent_push_pop("ConcurrentPushPop", ConcurrentPushPop);
+
+}  // namespace
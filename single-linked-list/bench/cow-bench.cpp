@@ -0,0 +1,60 @@
+#include <string>
+
+#include "bench/bench.h"
+#include "cow-single-linked-list.h"
+#include "single-linked-list.h"
+
+namespace {
+
+constexpr int kPassDepth = 8;
+
+// Передаёт список по значению через depth уровней вызовов, на каждом только читая его
+template <typename List>
+long long PassByValue(List list, int depth) {
+    if (depth == 0) {
+        return list.GetSize();
+    }
+    return *list.cbegin() + PassByValue(list, depth - 1);
+}
+
+template <typename List>
+void RunPassByValue(const BenchmarkOptions& options, const std::string& name) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        List list;
+        for (std::size_t i = 0; i < size; ++i) {
+            list.PushFront(static_cast<int>(i));
+        }
+        ReportBenchmark("CowPassByValue<" + name + ">", size, Measure(options, kPassDepth, [&] {
+            DoNotOptimize(PassByValue(list, kPassDepth - 1));
+        }));
+    }
+}
+
+// Копия списка, в начале которой заменяется, добавляется и удаляется по элементу
+template <typename List>
+void RunForkModifyFront(const BenchmarkOptions& options, const std::string& name) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        List list;
+        for (std::size_t i = 0; i < size; ++i) {
+            list.PushFront(static_cast<int>(i));
+        }
+        ReportBenchmark("CowForkModifyFront<" + name + ">", size, Measure(options, 1, [&] {
+            List fork = list;
+            *fork.begin() = -1;
+            fork.PushFront(-2);
+            fork.EraseAfter(fork.cbegin());
+            DoNotOptimize(*fork.cbegin());
+        }));
+    }
+}
+
+void Cow(const BenchmarkOptions& options) {
+    RunPassByValue<SingleLinkedList<int>>(options, "SingleLinkedList");
+    RunPassByValue<CowSingleLinkedList<int>>(options, "CowSingleLinkedList");
+    RunForkModifyFront<SingleLinkedList<int>>(options, "SingleLinkedList");
+    RunForkModifyFront<CowSingleLinkedList<int>>(options, "CowSingleLinkedList");
+}
+
+BenchmarkRegistrar cow("Cow", Cow);
+
+}  // namespace
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "intrusive-single-linked-list.h"
+#include "single-linked-list.h"
+
+namespace {
+
+// Объект, которым владеет внешний код. Список лишь связывает уже существующие объекты
+struct Record {
+    long long payload = 0;
+    IntrusiveListHook hook;
+};
+
+// При shuffled порядок включения в список не совпадает с порядком размещения объектов в памяти
+std::vector<std::unique_ptr<Record>> MakeRecords(std::size_t size, bool shuffled) {
+    std::vector<std::unique_ptr<Record>> records;
+    records.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        records.push_back(std::make_unique<Record>());
+        records.back()->payload = static_cast<long long>(i);
+    }
+    if (shuffled) {
+        std::shuffle(records.begin(), records.end(), std::mt19937(42));
+    }
+    return records;
+}
+
+// Включение в список, обход и удаление из списка объектов, созданных заранее:
+// интрузивный список против SingleLinkedList<Record*>
+void RunIntrusive(const BenchmarkOptions& options, bool shuffled) {
+    const std::string order = shuffled ? ",Shuffled>" : ",Sequential>";
+    for (std::size_t size : BenchmarkSizes(options)) {
+        const auto records = MakeRecords(size, shuffled);
+
+        IntrusiveSingleLinkedList<Record, &Record::hook> intrusive;
+        ReportBenchmark("Link<Intrusive" + order, size, Measure(options, size, [&] {
+            intrusive.Clear();
+        }, [&] {
+            for (const auto& record : records) {
+                intrusive.PushFront(*record);
+            }
+        }));
+        ReportBenchmark("Iterate<Intrusive" + order, size, Measure(options, size, [&] {
+            long long sum = 0;
+            for (const Record& record : intrusive) {
+                sum += record.payload;
+            }
+            DoNotOptimize(sum);
+        }));
+        ReportBenchmark("Unlink<Intrusive" + order, size, Measure(options, size, [&] {
+            intrusive.Clear();
+            for (const auto& record : records) {
+                intrusive.PushFront(*record);
+            }
+        }, [&] {
+            while (!intrusive.IsEmpty()) {
+                intrusive.PopFront();
+            }
+        }));
+
+        SingleLinkedList<Record*> owning;
+        ReportBenchmark("Link<SingleLinkedList<Record*>" + order, size, Measure(options, size, [&] {
+            owning.Clear();
+        }, [&] {
+            for (const auto& record : records) {
+                owning.PushFront(record.get());
+            }
+        }));
+        ReportBenchmark("Iterate<SingleLinkedList<Record*>" + order, size, Measure(options, size, [&] {
+            long long sum = 0;
+            for (const Record* record : owning) {
+                sum += record->payload;
+            }
+            DoNotOptimize(sum);
+        }));
+        ReportBenchmark("Unlink<SingleLinkedList<Record*>" + order, size, Measure(options, size, [&] {
+            owning.Clear();
+            for (const auto& record : records) {
+                owning.PushFront(record.get());
+            }
+        }, [&] {
+            while (!owning.IsEmpty()) {
+                owning.PopFront();
+            }
+        }));
+    }
+}
+
+void Intrusive(const BenchmarkOptions& options) {
+    RunIntrusive(options, false);
+    RunIntrusive(options, true);
+}
+
+BenchmarkRegistrar intrusive("Intrusive", Intrusive);
+
+}  // namespace
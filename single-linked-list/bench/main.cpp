@@ -0,0 +1,29 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "bench/bench.h"
+
+// Запуск: bench [--max-size=N] [--repetitions=N] [фильтр]
+// Выполняются только замеры, в имени которых встречается фильтр
+int main(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    std::string filter;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--max-size=", 0) == 0) {
+            options.max_size = std::strtoull(arg.c_str() + 11, nullptr, 10);
+        } else if (arg.rfind("--repetitions=", 0) == 0) {
+            options.repetitions = std::atoi(arg.c_str() + 14);
+        } else {
+            filter = arg;
+        }
+    }
+
+    for (const auto& [name, function] : GetBenchmarks()) {
+        if (name.find(filter) != std::string::npos) {
+            std::cout << "# " << name << std::endl;
+            function(options);
+        }
+    }
+}
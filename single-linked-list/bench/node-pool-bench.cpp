@@ -0,0 +1,44 @@
+#include <memory>
+#include <string>
+
+#include "bench/bench.h"
+#include "node-pool.h"
+#include "single-linked-list.h"
+
+namespace {
+
+// Чередование вставок и удалений в начале списка: на каждую партию из size
+// вставок приходится столько же удалений, список постоянно растёт и опустошается
+template <typename List>
+void RunPushPopChurn(const BenchmarkOptions& options, const std::string& name, List& list) {
+    constexpr int rounds = 10;
+    for (std::size_t size : BenchmarkSizes(options)) {
+        const double ns = MeasureNsPerOp(options, size * rounds * 2, [&] {
+            for (int round = 0; round < rounds; ++round) {
+                for (std::size_t i = 0; i < size; ++i) {
+                    list.PushFront(static_cast<int>(i));
+                }
+                for (std::size_t i = 0; i < size; ++i) {
+                    list.PopFront();
+                }
+            }
+            DoNotOptimize(list.GetSize());
+        });
+        ReportBenchmark(name, size, ns);
+    }
+}
+
+void PushPopChurn(const BenchmarkOptions& options) {
+    {
+        SingleLinkedList<int> list;
+        RunPushPopChurn(options, "PushPopChurn<new/delete>", list);
+    }
+    {
+        SingleLinkedList<int, PoolAllocator<int>> list;
+        RunPushPopChurn(options, "PushPopChurn<NodePool>", list);
+    }
+}
+
+BenchmarkRegistrar push_pop_churn("PushPopChurn", PushPopChurn);
+
+}  // namespace
@@ -0,0 +1,229 @@
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "single-linked-list.h"
+
+// Основные операции SingleLinkedList для разных типов элементов в сравнении с std::forward_list
+
+namespace {
+
+// Тривиально копируемая структура размером 64 байта
+struct Pod64 {
+    std::int64_t fields[8];
+};
+
+bool operator==(const Pod64& lhs, const Pod64& rhs) {
+    return std::equal(std::begin(lhs.fields), std::end(lhs.fields), std::begin(rhs.fields));
+}
+
+bool operator<(const Pod64& lhs, const Pod64& rhs) {
+    return std::lexicographical_compare(std::begin(lhs.fields), std::end(lhs.fields), std::begin(rhs.fields), std::end(rhs.fields));
+}
+
+template <typename T>
+T MakeValue(std::size_t index);
+
+template <>
+int MakeValue<int>(std::size_t index) {
+    return static_cast<int>(index);
+}
+
+template <>
+Pod64 MakeValue<Pod64>(std::size_t index) {
+    Pod64 value{};
+    std::fill(std::begin(value.fields), std::end(value.fields), static_cast<std::int64_t>(index));
+    return value;
+}
+
+// Строки длиннее буфера короткой строки, чтобы каждая копия выделяла память
+template <>
+std::string MakeValue<std::string>(std::size_t index) {
+    std::string value = std::to_string(index);
+    value.insert(0, 32 - value.size(), '0');
+    return value;
+}
+
+template <typename T>
+std::vector<T> MakeValues(std::size_t size) {
+    std::vector<T> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        values.push_back(MakeValue<T>(i));
+    }
+    return values;
+}
+
+// Единый интерфейс к SingleLinkedList и std::forward_list
+
+template <typename T>
+void Fill(SingleLinkedList<T>& list, const std::vector<T>& values) {
+    list.Clear();
+    list.CreateLinkedList(values.begin(), values.end());
+}
+
+template <typename T>
+void Fill(std::forward_list<T>& list, const std::vector<T>& values) {
+    list.assign(values.begin(), values.end());
+}
+
+template <typename T>
+void PushFront(SingleLinkedList<T>& list, const T& value) {
+    list.PushFront(value);
+}
+
+template <typename T>
+void PushFront(std::forward_list<T>& list, const T& value) {
+    list.push_front(value);
+}
+
+template <typename T>
+auto InsertAfter(SingleLinkedList<T>& list, typename SingleLinkedList<T>::ConstIterator pos, const T& value) {
+    return list.InsertAfter(pos, value);
+}
+
+template <typename T>
+auto InsertAfter(std::forward_list<T>& list, typename std::forward_list<T>::const_iterator pos, const T& value) {
+    return list.insert_after(pos, value);
+}
+
+template <typename T>
+void EraseAfter(SingleLinkedList<T>& list, typename SingleLinkedList<T>::ConstIterator pos) {
+    list.EraseAfter(pos);
+}
+
+template <typename T>
+void EraseAfter(std::forward_list<T>& list, typename std::forward_list<T>::const_iterator pos) {
+    list.erase_after(pos);
+}
+
+template <typename T>
+void PopFront(SingleLinkedList<T>& list) {
+    list.PopFront();
+}
+
+template <typename T>
+void PopFront(std::forward_list<T>& list) {
+    list.pop_front();
+}
+
+template <typename T>
+void Clear(SingleLinkedList<T>& list) {
+    list.Clear();
+}
+
+template <typename T>
+void Clear(std::forward_list<T>& list) {
+    list.clear();
+}
+
+template <typename List>
+auto Middle(const List& list, std::size_t offset) {
+    auto it = list.cbegin();
+    std::advance(it, offset);
+    return it;
+}
+
+template <typename T>
+std::size_t Weight(const T&) {
+    return 1;
+}
+
+std::size_t Weight(const std::string& value) {
+    return value.size();
+}
+
+template <typename List>
+void RunOperations(const BenchmarkOptions& options, const std::string& suffix) {
+    using T = typename List::value_type;
+    for (std::size_t size : BenchmarkSizes(options)) {
+        const std::vector<T> values = MakeValues<T>(size);
+        List list;
+        std::optional<List> copy;
+        decltype(list.cbegin()) middle;
+
+        ReportBenchmark("PushFront" + suffix, size, Measure(options, size, [&] {
+            Clear(list);
+        }, [&] {
+            for (const T& value : values) {
+                PushFront(list, value);
+            }
+        }));
+
+        ReportBenchmark("InsertAfterMiddle" + suffix, size, Measure(options, size, [&] {
+            Fill(list, values);
+            middle = Middle(list, size / 2);
+        }, [&] {
+            for (const T& value : values) {
+                InsertAfter(list, middle, value);
+            }
+        }));
+
+        ReportBenchmark("EraseAfterMiddle" + suffix, size, Measure(options, size / 2, [&] {
+            Fill(list, values);
+            middle = Middle(list, size / 4);
+        }, [&] {
+            for (std::size_t i = 0; i < size / 2; ++i) {
+                EraseAfter(list, middle);
+            }
+        }));
+
+        ReportBenchmark("PopFront" + suffix, size, Measure(options, size, [&] {
+            Fill(list, values);
+        }, [&] {
+            for (std::size_t i = 0; i < size; ++i) {
+                PopFront(list);
+            }
+        }));
+
+        ReportBenchmark("Clear" + suffix, size, Measure(options, size, [&] {
+            Fill(list, values);
+        }, [&] {
+            Clear(list);
+        }));
+
+        Fill(list, values);
+        ReportBenchmark("CopyConstruct" + suffix, size, Measure(options, size, [&] {
+            copy.reset();
+        }, [&] {
+            copy.emplace(list);
+        }));
+
+        ReportBenchmark("Equal" + suffix, size, Measure(options, size, [&] {
+            DoNotOptimize(list == *copy);
+        }));
+
+        ReportBenchmark("Less" + suffix, size, Measure(options, size, [&] {
+            DoNotOptimize(list < *copy);
+        }));
+
+        ReportBenchmark("Iterate" + suffix, size, Measure(options, size, [&] {
+            std::size_t sum = 0;
+            for (const T& value : list) {
+                sum += Weight(value);
+            }
+            DoNotOptimize(sum);
+        }));
+    }
+}
+
+template <typename T>
+void RunContainers(const BenchmarkOptions& options, const std::string& type_name) {
+    RunOperations<SingleLinkedList<T>>(options, "<SingleLinkedList," + type_name + ">");
+    RunOperations<std::forward_list<T>>(options, "<forward_list," + type_name + ">");
+}
+
+void Operations(const BenchmarkOptions& options) {
+    RunContainers<int>(options, "int");
+    RunContainers<Pod64>(options, "Pod64");
+    RunContainers<std::string>(options, "string");
+}
+
+BenchmarkRegistrar operations("Operations", Operations);
+
+}  // namespace
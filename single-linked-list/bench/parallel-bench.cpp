@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench/bench.h"
+#include "parallel-algorithms.h"
+#include "single-linked-list.h"
+
+namespace {
+
+// Работа над одним элементом, заметно дороже перехода по указателю
+double Heavy(double value) {
+    for (int i = 0; i < 16; ++i) {
+        value = std::sqrt(value + i);
+    }
+    return value;
+}
+
+void Parallel(const BenchmarkOptions& options) {
+    const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t size : BenchmarkSizes(options)) {
+        std::vector<double> values(size);
+        std::iota(values.begin(), values.end(), 0.0);
+        SingleLinkedList<double> list;
+        list.CreateLinkedList(values.begin(), values.end());
+
+        ReportBenchmark("Reduce<Serial>", size, MeasureNsPerOp(options, size, [&] {
+            DoNotOptimize(std::accumulate(list.begin(), list.end(), 0.0));
+        }));
+        ReportBenchmark("ForEachHeavy<Serial>", size, MeasureNsPerOp(options, size, [&] {
+            std::for_each(list.begin(), list.end(), [](double& value) {
+                value = Heavy(value);
+            });
+        }));
+        ReportBenchmark("FindIf<Serial>", size, MeasureNsPerOp(options, size, [&] {
+            DoNotOptimize(std::find_if(list.begin(), list.end(), [](double value) {
+                return value < 0;
+            }));
+        }));
+
+        for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+            ThreadPool pool(threads);
+            const std::string suffix = "<Parallel,threads:" + std::to_string(threads) + ">";
+
+            ReportBenchmark("BuildSplitIndex" + suffix, size, MeasureNsPerOp(options, size, [&] {
+                SplitIndex index(list, DefaultSplitStep(list, pool));
+                DoNotOptimize(index.GetChunkCount());
+            }));
+
+            const SplitIndex index(list, DefaultSplitStep(list, pool));
+            ReportBenchmark("Reduce" + suffix, size, MeasureNsPerOp(options, size, [&] {
+                DoNotOptimize(ParallelReduce(pool, index, 0.0, std::plus<>()));
+            }));
+            ReportBenchmark("ForEachHeavy" + suffix, size, MeasureNsPerOp(options, size, [&] {
+                ParallelForEach(pool, index, [](double& value) {
+                    value = Heavy(value);
+                });
+            }));
+            ReportBenchmark("FindIf" + suffix, size, MeasureNsPerOp(options, size, [&] {
+                DoNotOptimize(ParallelFindIf(pool, index, [](double value) {
+                    return value < 0;
+                }));
+            }));
+        }
+    }
+}
+
+BenchmarkRegistrar parallel("Parallel", Parallel);
+
+}  // namespace
@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "single-linked-list.h"
+
+namespace {
+
+// Список из size узлов, порядок которых в списке не связан с их расположением в памяти:
+// узлы выделяются подряд со случайной перестановкой значений, а затем сортировка перецепляет их.
+// Каждый переход по next_node попадает в случайное место, и аппаратная предвыборка не помогает
+SingleLinkedList<int> MakeShuffledList(std::size_t size, unsigned seed) {
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(seed));
+    SingleLinkedList<int> list;
+    list.InsertAfter(list.cbefore_begin(), values.begin(), values.end());
+    list.Sort();
+    return list;
+}
+
+// Обход итераторами сравнивается с обходом с упреждающим курсором на разной дальности.
+// Упреждение имеет смысл, только когда список намного больше кеша последнего уровня, например --max-size=10000000
+void Prefetch(const BenchmarkOptions& options) {
+    const std::vector<std::size_t> distances = {0, 4, SingleLinkedList<int>::kPrefetchDistance, 16, 32};
+    for (std::size_t size : BenchmarkSizes(options)) {
+        const SingleLinkedList<int> list = MakeShuffledList(size, 1);
+        const SingleLinkedList<int> copy = MakeShuffledList(size, 1);
+        // Отсутствующее значение, чтобы Find проходил весь список
+        const int missing = -1;
+
+        ReportBenchmark("Find<Iterator>", size, Measure(options, size, [&] {
+            DoNotOptimize(std::find(list.begin(), list.end(), missing) == list.end());
+        }));
+        ReportBenchmark("Accumulate<Iterator>", size, Measure(options, size, [&] {
+            DoNotOptimize(std::accumulate(list.begin(), list.end(), 0LL));
+        }));
+        ReportBenchmark("Equal<Iterator>", size, Measure(options, size, [&] {
+            DoNotOptimize(std::equal(list.begin(), list.end(), copy.begin(), copy.end()));
+        }));
+
+        for (std::size_t distance : distances) {
+            const std::string suffix = "<Prefetch=" + std::to_string(distance) + ">";
+            ReportBenchmark("Find" + suffix, size, Measure(options, size, [&] {
+                DoNotOptimize(list.Find(missing, distance) == list.end());
+            }));
+            ReportBenchmark("Count" + suffix, size, Measure(options, size, [&] {
+                DoNotOptimize(list.Count(missing, distance));
+            }));
+            ReportBenchmark("Accumulate" + suffix, size, Measure(options, size, [&] {
+                DoNotOptimize(list.Accumulate(0LL, std::plus<>(), distance));
+            }));
+            ReportBenchmark("Equal" + suffix, size, Measure(options, size, [&] {
+                DoNotOptimize(list.Mismatch(copy, std::equal_to<>(), distance).first == list.end());
+            }));
+        }
+    }
+}
+
+BenchmarkRegistrar prefetch("Prefetch", Prefetch);
+
+}  // namespace
@@ -0,0 +1,94 @@
+#include <deque>
+#include <queue>
+#include <string>
+
+#include "bench/bench.h"
+#include "node-pool.h"
+#include "single-linked-list.h"
+
+namespace {
+
+template <typename Type>
+using ListQueue = SingleLinkedList<Type, std::allocator<Type>, true>;
+
+template <typename Type>
+using PooledListQueue = SingleLinkedList<Type, PoolAllocator<Type>, true>;
+
+template <typename Type, typename Alloc>
+void Push(SingleLinkedList<Type, Alloc, true>& queue, const Type& value) {
+    queue.PushBack(value);
+}
+
+template <typename Type, typename Alloc>
+Type Pop(SingleLinkedList<Type, Alloc, true>& queue) {
+    Type value = queue.front();
+    queue.PopFront();
+    return value;
+}
+
+template <typename Type>
+void Push(std::deque<Type>& queue, const Type& value) {
+    queue.push_back(value);
+}
+
+template <typename Type>
+Type Pop(std::deque<Type>& queue) {
+    Type value = queue.front();
+    queue.pop_front();
+    return value;
+}
+
+template <typename Type>
+void Push(std::queue<Type>& queue, const Type& value) {
+    queue.push(value);
+}
+
+template <typename Type>
+Type Pop(std::queue<Type>& queue) {
+    Type value = queue.front();
+    queue.pop();
+    return value;
+}
+
+// Производитель и потребитель в одном потоке: очередь поддерживается размера size,
+// каждая операция — добавление в конец и извлечение из начала
+template <typename Queue>
+void RunFifo(const BenchmarkOptions& options, const std::string& name) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        Queue queue;
+        for (std::size_t i = 0; i < size; ++i) {
+            Push(queue, static_cast<int>(i));
+        }
+        ReportBenchmark("FifoSteadyState<" + name + ">", size, Measure(options, size, [&] {
+            long long sum = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                Push(queue, static_cast<int>(i));
+                sum += Pop(queue);
+            }
+            DoNotOptimize(sum);
+        }));
+
+        Queue batch;
+        ReportBenchmark("FifoFillDrain<" + name + ">", size, Measure(options, size * 2, [&] {
+            for (std::size_t i = 0; i < size; ++i) {
+                Push(batch, static_cast<int>(i));
+            }
+            long long sum = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                sum += Pop(batch);
+            }
+            DoNotOptimize(sum);
+        }));
+    }
+}
+
+void Fifo(const BenchmarkOptions& options) {
+    RunFifo<ListQueue<int>>(options, "SingleLinkedList");
+    RunFifo<PooledListQueue<int>>(options, "SingleLinkedList,NodePool");
+    RunFifo<std::deque<int>>(options, "deque");
+    RunFifo<std::queue<int>>(options, "queue");
+}
+
+BenchmarkRegistrar fifo("Fifo", Fifo);
+
+}  // namespace
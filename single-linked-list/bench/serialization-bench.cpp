@@ -0,0 +1,75 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "bench/bench.h"
+#include "mapped-single-linked-list.h"
+#include "node-pool.h"
+#include "single-linked-list.h"
+
+namespace {
+
+// Загрузка прежним способом: элементы читаются из потока по одному и добавляются в конец списка
+SingleLinkedList<int, std::allocator<int>, true> LoadElementwise(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    SingleLinkedList<int, std::allocator<int>, true> list;
+    int value = 0;
+    while (file.read(reinterpret_cast<char*>(&value), sizeof(value))) {
+        list.PushBack(value);
+    }
+    return list;
+}
+
+void Load(const BenchmarkOptions& options) {
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+    const std::string elementwise_path = (directory / "single-linked-list-bench-elements.bin").string();
+    const std::string image_path = (directory / "single-linked-list-bench-image.bin").string();
+
+    for (std::size_t size : BenchmarkSizes(options)) {
+        SingleLinkedList<int> source;
+        for (std::size_t i = 0; i < size; ++i) {
+            source.PushFront(static_cast<int>(i));
+        }
+        {
+            std::ofstream elements(elementwise_path, std::ios::binary);
+            for (int value : source) {
+                elements.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+            std::ofstream image(image_path, std::ios::binary);
+            source.Serialize(image);
+        }
+
+        ReportBenchmark("Load<Elementwise>", size, Measure(options, size, [&] {
+            DoNotOptimize(LoadElementwise(elementwise_path).GetSize());
+        }));
+        ReportBenchmark("Load<Deserialize>", size, Measure(options, size, [&] {
+            std::ifstream image(image_path, std::ios::binary);
+            DoNotOptimize(SingleLinkedList<int>::Deserialize(image).GetSize());
+        }));
+        ReportBenchmark("Load<Deserialize,NodePool>", size, Measure(options, size, [&] {
+            std::ifstream image(image_path, std::ios::binary);
+            DoNotOptimize(SingleLinkedList<int, PoolAllocator<int>>::Deserialize(image).GetSize());
+        }));
+        ReportBenchmark("Load<Mapped>", size, Measure(options, size, [&] {
+            MappedSingleLinkedList<int> mapped(image_path);
+            DoNotOptimize(mapped.GetSize());
+        }));
+        // Открытие и полный обход: каждая страница образа действительно читается
+        ReportBenchmark("Load<Mapped,Scan>", size, Measure(options, size, [&] {
+            MappedSingleLinkedList<int> mapped(image_path);
+            long long sum = 0;
+            for (int value : mapped) {
+                sum += value;
+            }
+            DoNotOptimize(sum);
+        }));
+    }
+
+    std::filesystem::remove(elementwise_path);
+    std::filesystem::remove(image_path);
+}
+
+BenchmarkRegistrar load("Load", Load);
+
+}  // namespace
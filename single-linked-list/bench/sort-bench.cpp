@@ -0,0 +1,50 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "single-linked-list.h"
+
+namespace {
+
+std::vector<int> MakeShuffled(std::size_t size) {
+    std::mt19937 generator(static_cast<unsigned>(size));
+    std::vector<int> values(size);
+    for (int& value : values) {
+        value = static_cast<int>(generator());
+    }
+    return values;
+}
+
+// Сортировка списка на месте против копирования в вектор, std::stable_sort и пересборки списка
+void Sort(const BenchmarkOptions& options) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        const std::vector<int> values = MakeShuffled(size);
+        SingleLinkedList<int> list;
+        const auto refill = [&] {
+            list.Clear();
+            list.CreateLinkedList(values.begin(), values.end());
+        };
+
+        const double in_place = MeasureNsPerOp(options, size, refill, [&] {
+            list.Sort();
+            DoNotOptimize(*list.begin());
+        });
+        ReportBenchmark("Sort<InPlace>", size, in_place);
+
+        const double round_trip = MeasureNsPerOp(options, size, refill, [&] {
+            std::vector<int> buffer(list.begin(), list.end());
+            std::stable_sort(buffer.begin(), buffer.end());
+            SingleLinkedList<int> sorted;
+            sorted.CreateLinkedList(buffer.begin(), buffer.end());
+            list.swap(sorted);
+            DoNotOptimize(*list.begin());
+        });
+        ReportBenchmark("Sort<VectorRoundTrip>", size, round_trip);
+    }
+}
+
+BenchmarkRegistrar sort("Sort", Sort);
+
+}  // namespace
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench/bench.h"
+#include "single-linked-list.h"
+#include "spsc-queue.h"
+
+namespace {
+
+// Очередь на SingleLinkedList под мьютексом: то, чем пользуются без SpscQueue
+template <typename Type>
+class MutexQueue {
+public:
+    void Push(const Type& value) {
+        std::lock_guard guard(mutex_);
+        list_.PushBack(value);
+    }
+
+    bool TryPop(Type& value) {
+        std::lock_guard guard(mutex_);
+        if (list_.IsEmpty()) {
+            return false;
+        }
+        value = list_.front();
+        list_.PopFront();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    SingleLinkedList<Type, std::allocator<Type>, true> list_;
+};
+
+std::int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Производитель передаёт message_count отметок времени, дожидаясь получения предыдущей,
+// чтобы измерялась задержка одной передачи, а не время ожидания в очереди.
+// Возвращает задержки в наносекундах, отсортированные по возрастанию
+template <typename Queue>
+std::vector<std::int64_t> RunHandoff(std::size_t message_count) {
+    Queue queue;
+    std::atomic<std::size_t> received = 0;
+    std::vector<std::int64_t> latencies;
+    latencies.reserve(message_count);
+
+    std::thread consumer([&] {
+        std::int64_t sent_at = 0;
+        while (latencies.size() < message_count) {
+            if (queue.TryPop(sent_at)) {
+                latencies.push_back(NowNs() - sent_at);
+                received.store(latencies.size(), std::memory_order_release);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    for (std::size_t i = 0; i < message_count; ++i) {
+        queue.Push(NowNs());
+        while (received.load(std::memory_order_acquire) <= i) {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+
+    std::sort(latencies.begin(), latencies.end());
+    return latencies;
+}
+
+template <typename Queue>
+void RunLatency(const BenchmarkOptions& options, const std::string& name) {
+    std::vector<std::int64_t> latencies;
+    for (int i = 0; i < options.repetitions; ++i) {
+        auto run = RunHandoff<Queue>(options.max_size);
+        latencies.insert(latencies.end(), run.begin(), run.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double p) {
+        return static_cast<double>(latencies[static_cast<std::size_t>(p * (latencies.size() - 1))]);
+    };
+    ReportBenchmark("SpscLatency<" + name + ">/p50", options.max_size, percentile(0.5));
+    ReportBenchmark("SpscLatency<" + name + ">/p99", options.max_size, percentile(0.99));
+    ReportBenchmark("SpscLatency<" + name + ">/p999", options.max_size, percentile(0.999));
+}
+
+void SpscLatency(const BenchmarkOptions& options) {
+    RunLatency<SpscQueue<std::int64_t>>(options, "SpscQueue");
+    RunLatency<MutexQueue<std::int64_t>>(options, "Mutex");
+}
+
+// Однопоточная проверка того, что в установившемся режиме очередь не выделяет память
+void SpscSteadyState(const BenchmarkOptions& options) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        SpscQueue<int> queue;
+        std::vector<int> batch(size);
+        ReportBenchmark("SpscSteadyState<PushRange,PopBatch>", size, Measure(options, size * 2, [&] {
+            queue.PushRange(batch.begin(), batch.end());
+            DoNotOptimize(queue.PopBatch(batch.begin(), size));
+        }));
+
+        SpscQueue<int> single;
+        ReportBenchmark("SpscSteadyState<Push,TryPop>", size, Measure(options, size * 2, [&] {
+            int value = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                single.Push(static_cast<int>(i));
+            }
+            for (std::size_t i = 0; i < size; ++i) {
+                single.TryPop(value);
+            }
+            DoNotOptimize(value);
+        }));
+    }
+}
+
+BenchmarkRegistrar spsc_latency("SpscLatency", SpscLatency);
+BenchmarkRegistrar spsc_steady_state("SpscSteadyState", SpscSteadyState);
+
+}  // namespace
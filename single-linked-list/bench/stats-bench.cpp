@@ -0,0 +1,51 @@
+#include <forward_list>
+#include <string>
+
+#include "bench/bench.h"
+#include "list-stats.h"
+#include "single-linked-list.h"
+
+namespace {
+
+// Типичная нагрузка: заполнение, обход, копирование со сравнением и очистка
+template <typename List>
+void RunWorkload(const BenchmarkOptions& options, const std::string& name) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        ReportBenchmark("Stats<" + name + ">", size, Measure(options, size, [size] {
+            List list;
+            for (std::size_t i = 0; i < size; ++i) {
+                list.push_front(static_cast<int>(i));
+            }
+            long long sum = 0;
+            for (int value : list) {
+                sum += value;
+            }
+            const List copy = list;
+            DoNotOptimize(sum + (copy == list));
+            list.clear();
+        }));
+    }
+}
+
+// Адаптер к интерфейсу std::forward_list, чтобы все варианты выполняли один и тот же код
+template <typename Stats>
+class StatsList : public SingleLinkedList<int, std::allocator<int>, false, Stats> {
+public:
+    void push_front(int value) {
+        this->PushFront(value);
+    }
+
+    void clear() noexcept {
+        this->Clear();
+    }
+};
+
+void StatsOverhead(const BenchmarkOptions& options) {
+    RunWorkload<std::forward_list<int>>(options, "forward_list");
+    RunWorkload<StatsList<NoListStats>>(options, "Disabled");
+    RunWorkload<StatsList<ListStats<>>>(options, "Enabled");
+}
+
+BenchmarkRegistrar stats_overhead("StatsOverhead", StatsOverhead);
+
+}  // namespace
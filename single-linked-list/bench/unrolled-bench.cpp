@@ -0,0 +1,91 @@
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "bench/bench.h"
+#include "single-linked-list.h"
+#include "unrolled-single-linked-list.h"
+
+namespace {
+
+template <typename List>
+List MakeList(std::size_t size) {
+    std::vector<int> values(size);
+    std::iota(values.begin(), values.end(), 0);
+    List list;
+    list.CreateLinkedList(values.begin(), values.end());
+    return list;
+}
+
+// Полный обход списка и сравнение двух одинаковых списков
+template <typename List>
+void RunScan(const BenchmarkOptions& options, const std::string& name) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        const List list = MakeList<List>(size);
+        const List copy = list;
+        const double scan = MeasureNsPerOp(options, size, [&] {
+            long long sum = 0;
+            for (int value : list) {
+                sum += value;
+            }
+            DoNotOptimize(sum);
+        });
+        ReportBenchmark("Scan<" + name + ">", size, scan);
+
+        const double equal = MeasureNsPerOp(options, size, [&] {
+            DoNotOptimize(list == copy);
+        });
+        ReportBenchmark("Equal<" + name + ">", size, equal);
+    }
+}
+
+// Вставка после каждого элемента списка: размер удваивается за один проход
+template <typename List>
+void RunInsert(const BenchmarkOptions& options, const std::string& name) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        List list;
+        const double ns = MeasureNsPerOp(options, size, [&] {
+            list = MakeList<List>(size);
+        }, [&] {
+            for (auto it = list.cbegin(); it != list.cend(); ++it) {
+                it = list.InsertAfter(it, 0);
+            }
+            DoNotOptimize(list.GetSize());
+        });
+        ReportBenchmark("InsertAfterEach<" + name + ">", size, ns);
+    }
+}
+
+// Удаление каждого второго элемента списка
+template <typename List>
+void RunErase(const BenchmarkOptions& options, const std::string& name) {
+    for (std::size_t size : BenchmarkSizes(options)) {
+        List list;
+        const double ns = MeasureNsPerOp(options, size / 2, [&] {
+            list = MakeList<List>(size);
+        }, [&] {
+            for (auto it = list.cbegin(); it != list.cend();) {
+                it = list.EraseAfter(it);
+            }
+            DoNotOptimize(list.GetSize());
+        });
+        ReportBenchmark("EraseEveryOther<" + name + ">", size, ns);
+    }
+}
+
+template <typename List>
+void RunAll(const BenchmarkOptions& options, const std::string& name) {
+    RunScan<List>(options, name);
+    RunInsert<List>(options, name);
+    RunErase<List>(options, name);
+}
+
+void UnrolledList(const BenchmarkOptions& options) {
+    RunAll<SingleLinkedList<int>>(options, "SingleLinkedList");
+    RunAll<UnrolledSingleLinkedList<int, 16>>(options, "Unrolled16");
+    RunAll<UnrolledSingleLinkedList<int, 64>>(options, "Unrolled64");
+}
+
+BenchmarkRegistrar unrolled_list("UnrolledList", UnrolledList);
+
+}  // namespace
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+// Односвязный список для небольших тривиально копируемых типов с компактным размещением узлов.
+// Вместо отдельного выделения памяти под каждый узел значения хранятся в общем массиве,
+// а связи — в параллельном массиве 32-битных индексов. На элемент приходится sizeof(Type) + 4 байта
+// без выравнивающих пропусков и служебных заголовков аллокатора, а соседние узлы лежат рядом в памяти.
+// Освобождённые ячейки переиспользуются через список свободных.
+// Итераторы устроены так же, как у SingleLinkedList, и остаются действительными при вставке,
+// но ссылаются на сам список, поэтому не переживают swap и перемещение.
+// Ссылки и указатели на элементы могут стать недействительными при росте массива
+template <typename Type>
+class CompactSingleLinkedList {
+    // std::pair<int, int> не считается тривиально копируемым из-за operator=,
+    // поэтому достаточно тривиального копирования конструктором и тривиального разрушения
+    static_assert(std::is_trivially_copy_constructible_v<Type> && std::is_trivially_destructible_v<Type>,
+                  "CompactSingleLinkedList requires a trivially copyable type");
+
+    using Index = std::uint32_t;
+
+    // Индекс, обозначающий отсутствие узла
+    static constexpr Index kNone = std::numeric_limits<Index>::max();
+    // Индекс фиктивного узла, используется итератором "перед первым элементом"
+    static constexpr Index kHead = kNone - 1;
+
+public:
+    // Наибольшее количество узлов, которое можно адресовать 32-битным индексом
+    static constexpr size_t kMaxSize = kHead;
+
+    template <typename ValueType>
+    class BasicIterator {
+        friend class CompactSingleLinkedList;
+
+        using ListPointer = std::conditional_t<std::is_const_v<ValueType>, const CompactSingleLinkedList*, CompactSingleLinkedList*>;
+
+        BasicIterator(ListPointer list, Index node) noexcept
+            : list_(list)
+            , node_(node) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : list_(other.list_)
+            , node_(other.node_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        template <typename T>
+        [[nodiscard]] bool operator==(const BasicIterator<T>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        template <typename T>
+        [[nodiscard]] bool operator!=(const BasicIterator<T>& rhs) const noexcept {
+            return !(node_ == rhs.node_);
+        }
+
+        BasicIterator& operator++() noexcept {
+            assert(node_ != kNone);
+            node_ = node_ == kHead ? list_->head_ : list_->next_[node_];
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto past = *this;
+            ++(*this);
+            return past;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            return list_->values_[node_];
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return &list_->values_[node_];
+        }
+
+    private:
+        ListPointer list_ = nullptr;
+        Index node_ = kNone;
+    };
+
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    CompactSingleLinkedList() = default;
+
+    // Создаёт список из элементов интервала [first, last)
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    CompactSingleLinkedList(InputIt first, InputIt last) {
+        ConstIterator pos = cbefore_begin();
+        for (; first != last; ++first) {
+            pos = InsertAfter(pos, *first);
+        }
+    }
+
+    CompactSingleLinkedList(std::initializer_list<Type> values)
+        : CompactSingleLinkedList(values.begin(), values.end()) {
+    }
+
+    // Копирование и перемещение сводятся к копированию и перемещению двух массивов
+    CompactSingleLinkedList(const CompactSingleLinkedList&) = default;
+    CompactSingleLinkedList& operator=(const CompactSingleLinkedList&) = default;
+
+    CompactSingleLinkedList(CompactSingleLinkedList&& other) noexcept {
+        swap(other);
+    }
+
+    CompactSingleLinkedList& operator=(CompactSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Заранее выделяет место под count узлов
+    void Reserve(size_t count) {
+        values_.reserve(count);
+        next_.reserve(count);
+    }
+
+    void PushFront(const Type& value) {
+        InsertAfter(cbefore_begin(), value);
+    }
+
+    template <typename... Args>
+    Type& EmplaceFront(Args&&... args) {
+        return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+    }
+
+    // Первый элемент списка. Список не должен быть пустым
+    [[nodiscard]] Type& front() noexcept {
+        assert(!IsEmpty());
+        return values_[head_];
+    }
+
+    [[nodiscard]] const Type& front() const noexcept {
+        assert(!IsEmpty());
+        return values_[head_];
+    }
+
+    void swap(CompactSingleLinkedList& other) noexcept {
+        values_.swap(other.values_);
+        next_.swap(other.next_);
+        std::swap(head_, other.head_);
+        std::swap(free_, other.free_);
+        std::swap(size_, other.size_);
+    }
+
+    // Удаляет все элементы, сохраняя выделенную под узлы память
+    void Clear() noexcept {
+        values_.clear();
+        next_.clear();
+        head_ = kNone;
+        free_ = kNone;
+        size_ = 0;
+    }
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator(this, head_);
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator(this, kNone);
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator(this, head_);
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator(this, kNone);
+    }
+
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator(this, kHead);
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator(this, kHead);
+    }
+
+    Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    /*
+     * Записывает элемент, построенный из args, в свободную ячейку и вставляет его после pos.
+     * Возвращает итератор на вставленный элемент.
+     * Если выделение памяти выбросит исключение, список останется в прежнем состоянии
+     */
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        const Type value(std::forward<Args>(args)...);
+        Index node = free_;
+        if (node != kNone) {
+            free_ = next_[node];
+            values_[node] = value;
+        } else {
+            if (values_.size() == kMaxSize) {
+                throw std::length_error("CompactSingleLinkedList size exceeded");
+            }
+            node = static_cast<Index>(values_.size());
+            values_.push_back(value);
+            try {
+                next_.push_back(kNone);
+            } catch (...) {
+                values_.pop_back();
+                throw;
+            }
+        }
+        Index& link = LinkAfter(pos.node_);
+        next_[node] = link;
+        link = node;
+        ++size_;
+        return Iterator(this, node);
+    }
+
+    /*
+     * Удаляет элемент, следующий за pos, и возвращает его ячейку в список свободных.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        Index& link = LinkAfter(pos.node_);
+        const Index erased = link;
+        link = next_[erased];
+        next_[erased] = free_;
+        free_ = erased;
+        --size_;
+        return Iterator(this, link);
+    }
+
+    void PopFront() noexcept {
+        EraseAfter(cbefore_begin());
+    }
+
+private:
+    // Ссылка на индекс узла, следующего за node (для фиктивного узла — на head_)
+    Index& LinkAfter(Index node) noexcept {
+        return node == kHead ? head_ : next_[node];
+    }
+
+    std::vector<Type> values_;
+    // next_[i] — индекс узла, следующего за узлом i, либо kNone
+    std::vector<Index> next_;
+    // Индекс первого узла
+    Index head_ = kNone;
+    // Начало списка освобождённых ячеек, связанных через next_
+    Index free_ = kNone;
+    size_t size_ = 0;
+};
+
+
+template <typename Type>
+void swap(CompactSingleLinkedList<Type>& lhs, CompactSingleLinkedList<Type>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type>
+bool operator==(const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) {
+    return (lhs.GetSize() == rhs.GetSize()) && std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+bool operator!=(const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type>
+bool operator<(const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+bool operator<=(const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type>
+bool operator>(const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type>
+bool operator>=(const CompactSingleLinkedList<Type>& lhs, const CompactSingleLinkedList<Type>& rhs) {
+    return !(lhs < rhs);
+}
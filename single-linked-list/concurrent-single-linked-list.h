@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "hazard-pointers.h"
+
+
+// Односвязный список, допускающий одновременные PushFront и TryPopFront из разных потоков
+// без блокировок (стек Трайбера).
+// Голова списка меняется через compare_exchange, а извлечённые узлы освобождаются
+// через указатели опасности, поэтому узел не может быть переиспользован, пока другой поток
+// читает его next_node: это исключает и обращение к освобождённой памяти, и проблему ABA
+template <typename Type>
+class ConcurrentSingleLinkedList {
+    struct Node {
+        template <typename... Args>
+        explicit Node(Args&&... args)
+            : value(std::forward<Args>(args)...) {
+        }
+        Type value;
+        Node* next_node = nullptr;
+    };
+
+public:
+    ConcurrentSingleLinkedList() = default;
+
+    ConcurrentSingleLinkedList(const ConcurrentSingleLinkedList&) = delete;
+    ConcurrentSingleLinkedList& operator=(const ConcurrentSingleLinkedList&) = delete;
+
+    // Разрушение списка не должно выполняться одновременно с другими операциями над ним
+    ~ConcurrentSingleLinkedList() {
+        Node* node = head_.load(std::memory_order_acquire);
+        while (node != nullptr) {
+            delete std::exchange(node, node->next_node);
+        }
+    }
+
+    // Возвращает количество элементов. При одновременных изменениях значение приблизительное
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return head_.load(std::memory_order_acquire) == nullptr;
+    }
+
+    void PushFront(const Type& value) {
+        EmplaceFront(value);
+    }
+
+    void PushFront(Type&& value) {
+        EmplaceFront(std::move(value));
+    }
+
+    template <typename... Args>
+    void EmplaceFront(Args&&... args) {
+        Node* node = new Node(std::forward<Args>(args)...);
+        node->next_node = head_.load(std::memory_order_relaxed);
+        // Счётчик увеличивается до публикации узла: уменьшение в TryPopFront, извлёкшем этот узел,
+        // происходит после увеличения, и счётчик не уходит ниже нуля
+        size_.fetch_add(1, std::memory_order_relaxed);
+        while (!head_.compare_exchange_weak(node->next_node, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Извлекает первый элемент в value. Возвращает false, если список пуст
+    bool TryPopFront(Type& value) {
+        std::atomic<void*>& hazard = HazardPointers::ForCurrentThread();
+        Node* old_head = head_.load();
+        do {
+            // Публикуем голову и убеждаемся, что она не сменилась до публикации:
+            // после этого узел не будет освобождён, и чтение old_head->next_node безопасно
+            Node* protected_node;
+            do {
+                protected_node = old_head;
+                hazard.store(protected_node);
+                old_head = head_.load();
+            } while (old_head != protected_node);
+        } while (old_head != nullptr && !head_.compare_exchange_strong(old_head, old_head->next_node));
+        hazard.store(nullptr);
+
+        if (old_head == nullptr) {
+            return false;
+        }
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        // Узел уже отцеплен, поэтому передаётся на освобождение и тогда, когда перемещение значения
+        // выбрасывает исключение
+        try {
+            value = std::move(old_head->value);
+        } catch (...) {
+            RetireNode(old_head);
+            throw;
+        }
+        RetireNode(old_head);
+        return true;
+    }
+
+private:
+    static void RetireNode(Node* node) {
+        HazardPointers::Retire(node, [](void* retired) {
+            delete static_cast<Node*>(retired);
+        });
+    }
+
+    std::atomic<Node*> head_{nullptr};
+    std::atomic<size_t> size_{0};
+};
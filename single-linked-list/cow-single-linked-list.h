@@ -0,0 +1,430 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+
+// Односвязный список с копированием при записи.
+// Узлы неизменяемы, пока ими пользуются несколько списков: копия списка лишь увеличивает
+// счётчик ссылок первого узла, поэтому копирование и передача по значению выполняются за O(1).
+// Изменение копирует только узлы от начала списка до изменяемой позиции, если среди них есть
+// разделяемые, а общий хвост остаётся общим. Поэтому PushFront, PopFront и изменения в начале
+// списка выполняются за O(1), а InsertAfter и EraseAfter — за O(k), где k — номер позиции.
+// Счётчики ссылок атомарны: списки с общими узлами можно использовать из разных потоков,
+// как копии std::shared_ptr, но один список по-прежнему нельзя изменять одновременно из нескольких.
+// Разыменование изменяющего итератора копирует разделяемый узел, даже если элемент только читается,
+// поэтому для чтения копии следует использовать константные итераторы: они ничего не копируют.
+// Проход по копии изменяющим итератором копирует каждый разделяемый узел один раз и занимает O(n).
+// Итератор, через который изменяют элементы, становится недействительным при копировании списка.
+// Итератор на разделяемый узел, кроме того, становится недействительным при изменении списка
+// через другие итераторы
+template <typename Type>
+class CowSingleLinkedList {
+    struct Node;
+
+    struct NodeBase {
+        Node* next_node = nullptr;
+    };
+
+    // Узел владеет одной ссылкой на следующий узел
+    struct Node : NodeBase {
+        template <typename... Args>
+        explicit Node(Node* next, Args&&... args)
+            : NodeBase{next}
+            , value(std::forward<Args>(args)...) {
+        }
+
+        std::atomic<size_t> ref_count{1};
+        Type value;
+    };
+
+public:
+
+    template <typename ValueType>
+    class BasicIterator;
+
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    // Итератор по элементам. Изменяющий итератор помнит, принадлежит ли путь от начала списка
+    // до текущего узла только этому списку, и последний узел пути, который принадлежит только ему.
+    // При обращении к разделяемому узлу копируется лишь путь от этого узла до текущего
+    template <typename ValueType>
+    class BasicIterator {
+        friend class CowSingleLinkedList;
+        template <typename>
+        friend class BasicIterator;
+
+        static constexpr bool kMutable = !std::is_const_v<ValueType>;
+        using ListPointer = std::conditional_t<kMutable, CowSingleLinkedList*, const CowSingleLinkedList*>;
+
+        BasicIterator(NodeBase* node, ListPointer list, bool unique, NodeBase* owned) noexcept
+            : node_(node)
+            , list_(list)
+            , unique_(unique)
+            , owned_(owned) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : node_(other.node_)
+            , list_(other.list_)
+            , unique_(other.unique_)
+            , owned_(other.owned_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        template <typename T>
+        [[nodiscard]] bool operator==(const BasicIterator<T>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        template <typename T>
+        [[nodiscard]] bool operator!=(const BasicIterator<T>& rhs) const noexcept {
+            return !(node_ == rhs.node_);
+        }
+
+        BasicIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+            NodeBase* const prev = std::exchange(node_, node_->next_node);
+            if constexpr (kMutable) {
+                if (unique_) {
+                    owned_ = prev;
+                    unique_ = node_ == nullptr || !IsShared(static_cast<Node*>(node_));
+                }
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto past = *this;
+            ++(*this);
+            return past;
+        }
+
+        // Для изменяющего итератора копирует разделяемую часть пути до текущего узла,
+        // поэтому может выбросить исключение при копировании элементов
+        [[nodiscard]] reference operator*() const {
+            return *operator->();
+        }
+
+        [[nodiscard]] pointer operator->() const {
+            if constexpr (kMutable) {
+                if (!unique_) {
+                    node_ = list_->Detach(owned_, node_);
+                    owned_ = node_;
+                    unique_ = true;
+                }
+            }
+            return &static_cast<Node*>(node_)->value;
+        }
+
+    private:
+        mutable NodeBase* node_ = nullptr;
+        ListPointer list_ = nullptr;
+        mutable bool unique_ = false;
+        // Узел на пути к node_, путь до которого принадлежит только этому списку
+        mutable NodeBase* owned_ = nullptr;
+    };
+
+    CowSingleLinkedList() = default;
+
+    // Создаёт список из элементов интервала [first, last).
+    // При исключении уже созданные узлы удаляются
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    CowSingleLinkedList(InputIt first, InputIt last) {
+        NodeBase chain;
+        NodeBase* tail = &chain;
+        size_t size = 0;
+        try {
+            for (; first != last; ++first) {
+                tail->next_node = new Node(nullptr, *first);
+                tail = tail->next_node;
+                ++size;
+            }
+        } catch (...) {
+            Release(chain.next_node);
+            throw;
+        }
+        head_.next_node = chain.next_node;
+        size_ = size;
+    }
+
+    CowSingleLinkedList(std::initializer_list<Type> values)
+        : CowSingleLinkedList(values.begin(), values.end()) {
+    }
+
+    // Копия разделяет все узлы с other
+    CowSingleLinkedList(const CowSingleLinkedList& other) noexcept
+        : size_(other.size_) {
+        head_.next_node = AddRef(other.head_.next_node);
+    }
+
+    CowSingleLinkedList(CowSingleLinkedList&& other) noexcept {
+        swap(other);
+    }
+
+    CowSingleLinkedList& operator=(const CowSingleLinkedList& rhs) noexcept {
+        if (this != &rhs) {
+            CowSingleLinkedList temp(rhs);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    CowSingleLinkedList& operator=(CowSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    ~CowSingleLinkedList() {
+        Clear();
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    void PushFront(const Type& value) {
+        EmplaceFront(value);
+    }
+
+    void PushFront(Type&& value) {
+        EmplaceFront(std::move(value));
+    }
+
+    // Новый узел становится первым и забирает ссылку на прежний первый узел, ничего не копируя
+    template <typename... Args>
+    Type& EmplaceFront(Args&&... args) {
+        return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+    }
+
+    // Первый элемент списка только для чтения: узел может быть разделяемым.
+    // Для изменения используйте *begin(). Список не должен быть пустым
+    [[nodiscard]] const Type& front() const noexcept {
+        assert(!IsEmpty());
+        return head_.next_node->value;
+    }
+
+    void PopFront() noexcept {
+        EraseAfterUnique(&head_);
+    }
+
+    void swap(CowSingleLinkedList& other) noexcept {
+        std::swap(head_.next_node, other.head_.next_node);
+        std::swap(size_, other.size_);
+    }
+
+    // Отпускает узлы списка. Узлы, которыми пользуются другие списки, остаются им
+    void Clear() noexcept {
+        Release(std::exchange(head_.next_node, nullptr));
+        size_ = 0;
+    }
+
+    [[nodiscard]] Iterator begin() noexcept {
+        Node* first = head_.next_node;
+        return Iterator(first, this, first == nullptr || !IsShared(first), &head_);
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator(nullptr, this, true, nullptr);
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator(head_.next_node, this, false, MutableHead());
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator(nullptr, this, false, nullptr);
+    }
+
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator(&head_, this, true, &head_);
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator(MutableHead(), this, false, MutableHead());
+    }
+
+    Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return EmplaceAfter(pos, std::move(value));
+    }
+
+    /*
+     * Конструирует элемент после pos. Если путь до pos разделяется с другими списками,
+     * он предварительно копируется. Если pos получен из изменяющего итератора, копируется
+     * только разделяемая часть пути, которую он прошёл. Возвращает итератор на вставленный элемент.
+     * При исключении список остаётся в прежнем состоянии
+     */
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        NodeBase* target = Detach(pos.owned_, pos.node_);
+        Node* node = new Node(target->next_node, std::forward<Args>(args)...);
+        target->next_node = node;
+        ++size_;
+        return Iterator(node, this, true, node);
+    }
+
+    /*
+     * Удаляет элемент, следующий за pos. Если путь до pos разделяется с другими списками,
+     * он предварительно копируется. Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(ConstIterator pos) {
+        NodeBase* target = Detach(pos.owned_, pos.node_);
+        EraseAfterUnique(target);
+        Node* next = target->next_node;
+        return Iterator(next, this, next == nullptr || !IsShared(next), target);
+    }
+
+private:
+    NodeBase* MutableHead() const noexcept {
+        return const_cast<NodeBase*>(&head_);
+    }
+
+    static bool IsShared(const Node* node) noexcept {
+        return node->ref_count.load(std::memory_order_acquire) != 1;
+    }
+
+    static Node* AddRef(Node* node) noexcept {
+        if (node != nullptr) {
+            node->ref_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        return node;
+    }
+
+    // Отпускает ссылку на node. Узлы, на которые больше никто не ссылается, удаляются
+    // вместе со ссылками на следующие за ними узлы
+    static void Release(Node* node) noexcept {
+        while (node != nullptr && node->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete std::exchange(node, node->next_node);
+        }
+    }
+
+    // Удаляет узел, следующий за target. target должен принадлежать только этому списку
+    void EraseAfterUnique(NodeBase* target) noexcept {
+        Node* erased = target->next_node;
+        target->next_node = AddRef(erased->next_node);
+        Release(erased);
+        --size_;
+    }
+
+    // Делает путь от начала списка до target включительно принадлежащим только этому списку.
+    // Путь до owned уже принадлежит только этому списку, поэтому проверяются лишь узлы после него.
+    // Узлы, начиная с первого разделяемого и заканчивая target, заменяются копиями,
+    // которые ссылаются на общий хвост. Возвращает узел, соответствующий target.
+    // При исключении во время копирования список не изменяется
+    NodeBase* Detach(NodeBase* owned, NodeBase* target) {
+        NodeBase* prev = owned;
+        while (prev != target) {
+            Node* node = prev->next_node;
+            assert(node != nullptr);
+            if (IsShared(node)) {
+                return CopyPath(prev, target);
+            }
+            prev = node;
+        }
+        return prev;
+    }
+
+    // Копирует узлы после owner по target включительно и подставляет копии вместо них
+    NodeBase* CopyPath(NodeBase* owner, const NodeBase* target) {
+        NodeBase copies;
+        NodeBase* tail = &copies;
+        const NodeBase* original = owner;
+        try {
+            do {
+                original = original->next_node;
+                tail->next_node = new Node(nullptr, static_cast<const Node*>(original)->value);
+                tail = tail->next_node;
+            } while (original != target);
+        } catch (...) {
+            Release(copies.next_node);
+            throw;
+        }
+        tail->next_node = AddRef(original->next_node);
+        Release(std::exchange(owner->next_node, copies.next_node));
+        return tail;
+    }
+
+    // Фиктивный узел, используется для вставки "перед первым элементом"
+    NodeBase head_;
+    size_t size_ = 0;
+};
+
+
+template <typename Type>
+void swap(CowSingleLinkedList<Type>& lhs, CowSingleLinkedList<Type>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type>
+bool operator==(const CowSingleLinkedList<Type>& lhs, const CowSingleLinkedList<Type>& rhs) {
+    return (lhs.GetSize() == rhs.GetSize()) && std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+bool operator!=(const CowSingleLinkedList<Type>& lhs, const CowSingleLinkedList<Type>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type>
+bool operator<(const CowSingleLinkedList<Type>& lhs, const CowSingleLinkedList<Type>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+bool operator<=(const CowSingleLinkedList<Type>& lhs, const CowSingleLinkedList<Type>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type>
+bool operator>(const CowSingleLinkedList<Type>& lhs, const CowSingleLinkedList<Type>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type>
+bool operator>=(const CowSingleLinkedList<Type>& lhs, const CowSingleLinkedList<Type>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+// Указатели опасности (hazard pointers) для безопасного освобождения памяти
+// в неблокирующих структурах данных.
+// Поток, собирающийся разыменовать разделяемый узел, публикует его адрес в своём
+// указателе опасности. Удалённый из структуры узел не освобождается сразу, а откладывается
+// (Retire) и освобождается только тогда, когда ни один поток его не публикует
+class HazardPointers {
+public:
+    // Максимальное количество потоков, одновременно пользующихся указателями опасности
+    static constexpr size_t kMaxThreads = 128;
+
+    using Deleter = void (*)(void*);
+
+    // Возвращает указатель опасности текущего потока.
+    // При первом обращении поток занимает свободную запись,
+    // при завершении потока запись освобождается
+    static std::atomic<void*>& ForCurrentThread() {
+        thread_local ThreadRecord record;
+        return record.GetHazard();
+    }
+
+    // Откладывает освобождение ptr до момента, когда его не будет защищать ни один поток
+    static void Retire(void* ptr, Deleter deleter) {
+        RetiredList& retired = GetRetiredList();
+        retired.nodes.push_back({ptr, deleter});
+        if (retired.nodes.size() >= 2 * kMaxThreads) {
+            retired.Scan();
+        }
+    }
+
+private:
+    struct Record {
+        std::atomic<std::thread::id> owner{std::thread::id()};
+        std::atomic<void*> hazard{nullptr};
+    };
+
+    struct RetiredNode {
+        void* ptr;
+        Deleter deleter;
+    };
+
+    // Узлы, отложенные завершившимися потоками: их подбирает следующий Scan
+    struct Orphans {
+        std::mutex mutex;
+        std::vector<RetiredNode> nodes;
+    };
+
+    class ThreadRecord {
+    public:
+        ThreadRecord() {
+            Record* records = GetRecords();
+            for (Record* candidate = records; candidate != records + kMaxThreads; ++candidate) {
+                std::thread::id free_id;
+                if (candidate->owner.compare_exchange_strong(free_id, std::this_thread::get_id())) {
+                    record_ = candidate;
+                    return;
+                }
+            }
+            throw std::runtime_error("No hazard pointers available");
+        }
+
+        ThreadRecord(const ThreadRecord&) = delete;
+        ThreadRecord& operator=(const ThreadRecord&) = delete;
+
+        ~ThreadRecord() {
+            record_->hazard.store(nullptr);
+            record_->owner.store(std::thread::id());
+        }
+
+        std::atomic<void*>& GetHazard() noexcept {
+            return record_->hazard;
+        }
+
+    private:
+        Record* record_ = nullptr;
+    };
+
+    struct RetiredList {
+        RetiredList() = default;
+        RetiredList(const RetiredList&) = delete;
+        RetiredList& operator=(const RetiredList&) = delete;
+
+        ~RetiredList() {
+            Scan();
+            if (!nodes.empty()) {
+                Orphans& orphans = GetOrphans();
+                std::lock_guard guard(orphans.mutex);
+                orphans.nodes.insert(orphans.nodes.end(), nodes.begin(), nodes.end());
+            }
+        }
+
+        // Освобождает отложенные узлы, которые не защищены ни одним указателем опасности
+        void Scan() {
+            {
+                Orphans& orphans = GetOrphans();
+                std::lock_guard guard(orphans.mutex);
+                nodes.insert(nodes.end(), orphans.nodes.begin(), orphans.nodes.end());
+                orphans.nodes.clear();
+            }
+
+            std::vector<void*> hazards;
+            hazards.reserve(kMaxThreads);
+            const Record* records = GetRecords();
+            for (const Record* record = records; record != records + kMaxThreads; ++record) {
+                if (void* hazard = record->hazard.load()) {
+                    hazards.push_back(hazard);
+                }
+            }
+            std::sort(hazards.begin(), hazards.end());
+
+            auto releasable = std::partition(nodes.begin(), nodes.end(), [&hazards](const RetiredNode& node) {
+                return std::binary_search(hazards.begin(), hazards.end(), node.ptr);
+            });
+            for (auto it = releasable; it != nodes.end(); ++it) {
+                it->deleter(it->ptr);
+            }
+            nodes.erase(releasable, nodes.end());
+        }
+
+        std::vector<RetiredNode> nodes;
+    };
+
+    static RetiredList& GetRetiredList() {
+        thread_local RetiredList retired;
+        return retired;
+    }
+
+    static Record* GetRecords() {
+        static Record records[kMaxThreads];
+        return records;
+    }
+
+    static Orphans& GetOrphans() {
+        static Orphans orphans;
+        return orphans;
+    }
+};
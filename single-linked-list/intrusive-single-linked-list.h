@@ -0,0 +1,256 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+
+// Связь, встраиваемая в элемент интрузивного списка
+struct IntrusiveListHook {
+    IntrusiveListHook* next_node = nullptr;
+};
+
+// Интрузивный односвязный список: элементы связываются через встроенное поле Hook
+// и не копируются, поэтому вставка и удаление не выделяют память.
+// Список не владеет элементами: EraseAfter, PopFront и Clear только отцепляют их,
+// а временем жизни элементов управляет вызывающая сторона.
+// Элемент может одновременно состоять не более чем в одном списке на каждое поле-связь
+template <typename Type, IntrusiveListHook Type::*Hook>
+class IntrusiveSingleLinkedList {
+public:
+
+    template <typename ValueType>
+    class BasicIterator {
+        friend class IntrusiveSingleLinkedList;
+
+        explicit BasicIterator(IntrusiveListHook* node) noexcept
+            : node_(node) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : node_(other.node_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        template <typename T>
+        [[nodiscard]] bool operator==(const BasicIterator<T>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        template <typename T>
+        [[nodiscard]] bool operator!=(const BasicIterator<T>& rhs) const noexcept {
+            return !(node_ == rhs.node_);
+        }
+
+        BasicIterator& operator++() noexcept {
+            assert(node_ != nullptr);
+            node_ = node_->next_node;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto past = *this;
+            ++(*this);
+            return past;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            return *FromHook(node_);
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return FromHook(node_);
+        }
+
+    private:
+        IntrusiveListHook* node_ = nullptr;
+    };
+
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    IntrusiveSingleLinkedList() = default;
+
+    // Копирование не имеет смысла: элемент не может состоять в двух списках через одно поле
+    IntrusiveSingleLinkedList(const IntrusiveSingleLinkedList&) = delete;
+    IntrusiveSingleLinkedList& operator=(const IntrusiveSingleLinkedList&) = delete;
+
+    IntrusiveSingleLinkedList(IntrusiveSingleLinkedList&& other) noexcept {
+        swap(other);
+    }
+
+    IntrusiveSingleLinkedList& operator=(IntrusiveSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    ~IntrusiveSingleLinkedList() {
+        Clear();
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    void PushFront(Type& value) noexcept {
+        InsertAfter(cbefore_begin(), value);
+    }
+
+    void swap(IntrusiveSingleLinkedList& other) noexcept {
+        std::swap(head_.next_node, other.head_.next_node);
+        std::swap(size_, other.size_);
+    }
+
+    // Отцепляет все элементы, не разрушая их
+    void Clear() noexcept {
+        IntrusiveListHook* node = std::exchange(head_.next_node, nullptr);
+        while (node != nullptr) {
+            node = std::exchange(node->next_node, nullptr);
+        }
+        size_ = 0;
+    }
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator(head_.next_node);
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator(nullptr);
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator(head_.next_node);
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator(nullptr);
+    }
+
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator(&head_);
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator(const_cast<IntrusiveListHook*>(&head_));
+    }
+
+    /*
+     * Вставляет элемент value после pos. Элемент не должен состоять в другом списке.
+     * Возвращает итератор на вставленный элемент
+     */
+    Iterator InsertAfter(ConstIterator pos, Type& value) noexcept {
+        IntrusiveListHook* node = &(value.*Hook);
+        HookOffset(&value);
+        node->next_node = pos.node_->next_node;
+        pos.node_->next_node = node;
+        ++size_;
+        return Iterator(node);
+    }
+
+    /*
+     * Отцепляет элемент, следующий за pos, не разрушая его.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        IntrusiveListHook* erased = pos.node_->next_node;
+        pos.node_->next_node = std::exchange(erased->next_node, nullptr);
+        --size_;
+        return Iterator(pos.node_->next_node);
+    }
+
+    void PopFront() noexcept {
+        EraseAfter(cbefore_begin());
+    }
+
+private:
+    // Восстанавливает адрес элемента по адресу встроенной в него связи
+    static Type* FromHook(IntrusiveListHook* node) noexcept {
+        return reinterpret_cast<Type*>(reinterpret_cast<std::byte*>(node) - HookOffset());
+    }
+
+    // Смещение поля Hook от начала Type. Указатель на член не даёт его без объекта, поэтому
+    // смещение вычисляется один раз по первому вставленному элементу, а дальше только читается.
+    // Любая связь, переданная FromHook, попала в список через InsertAfter, так что смещение уже известно
+    static std::ptrdiff_t HookOffset(const Type* sample = nullptr) noexcept {
+        static const std::ptrdiff_t offset = [sample] {
+            assert(sample != nullptr);
+            return reinterpret_cast<const std::byte*>(&(sample->*Hook)) - reinterpret_cast<const std::byte*>(sample);
+        }();
+        return offset;
+    }
+
+    // Фиктивная связь, используется для вставки "перед первым элементом"
+    IntrusiveListHook head_;
+    size_t size_ = 0;
+};
+
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+void swap(IntrusiveSingleLinkedList<Type, Hook>& lhs, IntrusiveSingleLinkedList<Type, Hook>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+bool operator==(const IntrusiveSingleLinkedList<Type, Hook>& lhs, const IntrusiveSingleLinkedList<Type, Hook>& rhs) {
+    return (lhs.GetSize() == rhs.GetSize()) && std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+bool operator!=(const IntrusiveSingleLinkedList<Type, Hook>& lhs, const IntrusiveSingleLinkedList<Type, Hook>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+bool operator<(const IntrusiveSingleLinkedList<Type, Hook>& lhs, const IntrusiveSingleLinkedList<Type, Hook>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+bool operator<=(const IntrusiveSingleLinkedList<Type, Hook>& lhs, const IntrusiveSingleLinkedList<Type, Hook>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+bool operator>(const IntrusiveSingleLinkedList<Type, Hook>& lhs, const IntrusiveSingleLinkedList<Type, Hook>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, IntrusiveListHook Type::*Hook>
+bool operator>=(const IntrusiveSingleLinkedList<Type, Hook>& lhs, const IntrusiveSingleLinkedList<Type, Hook>& rhs) {
+    return !(lhs < rhs);
+}
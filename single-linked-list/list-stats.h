@@ -0,0 +1,209 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+
+// Значения счётчиков событий списка на момент снимка.
+// Счётчики только растут, поэтому события за интервал — разность двух снимков
+struct ListStatsSnapshot {
+    std::uint64_t node_allocations = 0;
+    std::uint64_t node_deallocations = 0;
+    std::uint64_t iterator_increments = 0;
+    std::uint64_t copy_constructions = 0;
+    std::uint64_t comparisons = 0;
+
+    // Количество узлов, выделенных и ещё не освобождённых
+    [[nodiscard]] std::int64_t GetLiveNodes() const noexcept {
+        return static_cast<std::int64_t>(node_allocations - node_deallocations);
+    }
+};
+
+inline ListStatsSnapshot operator-(const ListStatsSnapshot& lhs, const ListStatsSnapshot& rhs) noexcept {
+    return {lhs.node_allocations - rhs.node_allocations, lhs.node_deallocations - rhs.node_deallocations,
+            lhs.iterator_increments - rhs.iterator_increments, lhs.copy_constructions - rhs.copy_constructions,
+            lhs.comparisons - rhs.comparisons};
+}
+
+inline std::ostream& operator<<(std::ostream& output, const ListStatsSnapshot& snapshot) {
+    return output << "node_allocations=" << snapshot.node_allocations << " node_deallocations=" << snapshot.node_deallocations
+                  << " iterator_increments=" << snapshot.iterator_increments
+                  << " copy_constructions=" << snapshot.copy_constructions << " comparisons=" << snapshot.comparisons;
+}
+
+// Политика статистики по умолчанию: все обработчики событий пусты и исчезают при компиляции,
+// так что список без статистики не меняется ни по размеру, ни по коду
+struct NoListStats {
+    static constexpr bool kEnabled = false;
+
+    static constexpr void OnNodesAllocated(std::size_t) noexcept {
+    }
+    static constexpr void OnNodesDeallocated(std::size_t) noexcept {
+    }
+    static constexpr void OnIteratorIncrement() noexcept {
+    }
+    static constexpr void OnCopyConstruction() noexcept {
+    }
+    static constexpr void OnComparison() noexcept {
+    }
+};
+
+// Политика, подсчитывающая события всех списков, у которых она указана.
+// Каждый поток увеличивает собственные счётчики без блокировок и атомарных read-modify-write операций,
+// GetSnapshot суммирует их по всем потокам. Счётчики завершившихся потоков сохраняются.
+// Разные Tag дают независимые наборы счётчиков, например для разных подсистем
+template <typename Tag = void>
+class ListStats {
+public:
+    static constexpr bool kEnabled = true;
+
+    using DumpHook = std::function<void(const ListStatsSnapshot&)>;
+
+    static constexpr void OnNodesAllocated(std::size_t count) noexcept {
+        if (!std::is_constant_evaluated()) {
+            Add(kNodeAllocations, count);
+        }
+    }
+
+    static constexpr void OnNodesDeallocated(std::size_t count) noexcept {
+        if (!std::is_constant_evaluated()) {
+            Add(kNodeDeallocations, count);
+        }
+    }
+
+    static constexpr void OnIteratorIncrement() noexcept {
+        if (!std::is_constant_evaluated()) {
+            Add(kIteratorIncrements, 1);
+        }
+    }
+
+    static constexpr void OnCopyConstruction() noexcept {
+        if (!std::is_constant_evaluated()) {
+            Add(kCopyConstructions, 1);
+        }
+    }
+
+    static constexpr void OnComparison() noexcept {
+        if (!std::is_constant_evaluated()) {
+            Add(kComparisons, 1);
+        }
+    }
+
+    // Суммирует счётчики всех потоков. Значения счётчиков работающих потоков могут отставать
+    // на несколько последних событий
+    [[nodiscard]] static ListStatsSnapshot GetSnapshot() {
+        Registry& registry = GetRegistry();
+        std::lock_guard guard(registry.mutex);
+        ListStatsSnapshot snapshot = registry.finished;
+        for (const ThreadCounters* counters = registry.threads; counters != nullptr; counters = counters->next_) {
+            counters->AddTo(snapshot);
+        }
+        return snapshot;
+    }
+
+    // Задаёт обработчик, которому Dump передаёт снимок (например, для отправки в систему мониторинга).
+    // Пустой обработчик восстанавливает вывод в std::clog
+    static void SetDumpHook(DumpHook hook) {
+        Registry& registry = GetRegistry();
+        std::lock_guard guard(registry.mutex);
+        registry.dump_hook = std::move(hook);
+    }
+
+    // Передаёт текущий снимок обработчику, заданному SetDumpHook
+    static void Dump() {
+        const ListStatsSnapshot snapshot = GetSnapshot();
+        DumpHook hook;
+        {
+            Registry& registry = GetRegistry();
+            std::lock_guard guard(registry.mutex);
+            hook = registry.dump_hook;
+        }
+        if (hook) {
+            hook(snapshot);
+        } else {
+            std::clog << "SingleLinkedList stats: " << snapshot << std::endl;
+        }
+    }
+
+private:
+    enum Counter : std::size_t {
+        kNodeAllocations,
+        kNodeDeallocations,
+        kIteratorIncrements,
+        kCopyConstructions,
+        kComparisons,
+        kCounterCount
+    };
+
+    class ThreadCounters;
+
+    struct Registry {
+        std::mutex mutex;
+        // Счётчики работающих потоков связаны в список через ThreadCounters::next_,
+        // поэтому регистрация потока не выделяет память и не может выбросить std::bad_alloc
+        ThreadCounters* threads = nullptr;
+        // Сумма счётчиков завершившихся потоков
+        ListStatsSnapshot finished;
+        DumpHook dump_hook;
+    };
+
+    // Счётчики одного потока. Пишет в них только владелец, поэтому увеличение —
+    // это обычные загрузка и сохранение, а атомарность нужна лишь для чтения из GetSnapshot
+    class ThreadCounters {
+        friend class ListStats;
+
+    public:
+        ThreadCounters() noexcept {
+            Registry& registry = GetRegistry();
+            std::lock_guard guard(registry.mutex);
+            next_ = std::exchange(registry.threads, this);
+        }
+
+        ThreadCounters(const ThreadCounters&) = delete;
+        ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+        ~ThreadCounters() {
+            Registry& registry = GetRegistry();
+            std::lock_guard guard(registry.mutex);
+            AddTo(registry.finished);
+            ThreadCounters** link = &registry.threads;
+            while (*link != this) {
+                link = &(*link)->next_;
+            }
+            *link = next_;
+        }
+
+        void Add(Counter counter, std::size_t count) noexcept {
+            std::atomic<std::uint64_t>& value = values_[counter];
+            value.store(value.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+        }
+
+        void AddTo(ListStatsSnapshot& snapshot) const noexcept {
+            snapshot.node_allocations += values_[kNodeAllocations].load(std::memory_order_relaxed);
+            snapshot.node_deallocations += values_[kNodeDeallocations].load(std::memory_order_relaxed);
+            snapshot.iterator_increments += values_[kIteratorIncrements].load(std::memory_order_relaxed);
+            snapshot.copy_constructions += values_[kCopyConstructions].load(std::memory_order_relaxed);
+            snapshot.comparisons += values_[kComparisons].load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<std::uint64_t> values_[kCounterCount] = {};
+        ThreadCounters* next_ = nullptr;
+    };
+
+    static void Add(Counter counter, std::size_t count) noexcept {
+        thread_local ThreadCounters counters;
+        counters.Add(counter, count);
+    }
+
+    static Registry& GetRegistry() noexcept {
+        static Registry registry;
+        return registry;
+    }
+};
@@ -1,6 +1,50 @@
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
+#include "background-reclaimer.h"
+#include "compact-single-linked-list.h"
+#include "concurrent-single-linked-list.h"
+#include "cow-single-linked-list.h"
+#include "intrusive-single-linked-list.h"
+#include "list-stats.h"
+#include "mapped-single-linked-list.h"
+#include "node-pool.h"
+#include "parallel-algorithms.h"
 #include "single-linked-list.h"
+#include "spsc-queue.h"
+#include "static-single-linked-list.h"
+#include "unrolled-single-linked-list.h"
+
+// Аллокатор пула, который передаётся при копирующем присваивании, но не при обмене
+template <typename T>
+struct CopyPropagatingPoolAllocator : PoolAllocator<T> {
+    using propagate_on_container_swap = std::false_type;
+
+    template <typename U>
+    struct rebind {
+        using other = CopyPropagatingPoolAllocator<U>;
+    };
+
+    CopyPropagatingPoolAllocator() = default;
+
+    template <typename U>
+    CopyPropagatingPoolAllocator(const CopyPropagatingPoolAllocator<U>& other) noexcept
+        : PoolAllocator<T>(other) {
+    }
+};
 
 // Эта функция проверяет работу класса SingleLinkedList
 void Test() {
@@ -143,8 +187,1730 @@ void Test() {
             assert(deletion_counter == 1u);
         }
     }
+
+    // Список, узлы которого выделяются из пула
+    {
+        PoolAllocator<int> alloc;
+        const auto& pool = alloc.GetPool();
+        {
+            SingleLinkedList<int, PoolAllocator<int>> lst(alloc);
+            for (int i = 0; i < 1000; ++i) {
+                lst.PushFront(i);
+            }
+            assert(lst.GetSize() == 1000u);
+            assert(pool->GetLiveCount() == 1000u);
+            const size_t block_count = pool->GetBlockCount();
+
+            // Освобождённые узлы переиспользуются, новые блоки не выделяются
+            for (int round = 0; round < 10; ++round) {
+                for (int i = 0; i < 1000; ++i) {
+                    lst.PopFront();
+                }
+                assert(pool->GetLiveCount() == 0u);
+                for (int i = 0; i < 1000; ++i) {
+                    lst.PushFront(i);
+                }
+            }
+            assert(pool->GetBlockCount() == block_count);
+
+            // Копия списка пользуется тем же пулом
+            const auto copy(lst);
+            assert(copy == lst);
+            assert(copy.get_allocator() == alloc);
+            assert(pool->GetLiveCount() == 2000u);
+        }
+        assert(pool->GetLiveCount() == 0u);
+
+        SingleLinkedList<DeletionSpy, PoolAllocator<DeletionSpy>> list{DeletionSpy{}, DeletionSpy{}};
+        int deletion_counter = 0;
+        list.begin()->deletion_counter_ptr = &deletion_counter;
+        list.PopFront();
+        assert(deletion_counter == 1);
+    }
+
+    // Вспомогательный класс, подсчитывающий копирования и перемещения
+    struct CopyCounter {
+        CopyCounter(int* copies, int* moves) noexcept
+            : copies_ptr(copies)
+            , moves_ptr(moves) {
+        }
+        CopyCounter(const CopyCounter& other) noexcept
+            : copies_ptr(other.copies_ptr)
+            , moves_ptr(other.moves_ptr) {
+            ++(*copies_ptr);
+        }
+        CopyCounter(CopyCounter&& other) noexcept
+            : copies_ptr(other.copies_ptr)
+            , moves_ptr(other.moves_ptr) {
+            ++(*moves_ptr);
+        }
+        CopyCounter& operator=(const CopyCounter&) = delete;
+        int* copies_ptr;
+        int* moves_ptr;
+    };
+
+    // Вставка rvalue и конструирование элементов на месте
+    {
+        int copies = 0;
+        int moves = 0;
+        SingleLinkedList<CopyCounter> list;
+        list.EmplaceFront(&copies, &moves);
+        list.EmplaceAfter(list.cbegin(), &copies, &moves);
+        assert(copies == 0 && moves == 0);
+
+        list.PushFront(CopyCounter(&copies, &moves));
+        list.InsertAfter(list.cbegin(), CopyCounter(&copies, &moves));
+        assert(copies == 0 && moves == 2);
+        assert(list.GetSize() == 4u);
+
+        CopyCounter lvalue(&copies, &moves);
+        list.PushFront(lvalue);
+        list.InsertAfter(list.cbefore_begin(), lvalue);
+        assert(copies == 2 && moves == 2);
+    }
+
+    // Перемещение списка не копирует и не перемещает элементы
+    {
+        int copies = 0;
+        int moves = 0;
+        auto make_list = [&copies, &moves] {
+            SingleLinkedList<CopyCounter> list;
+            for (int i = 0; i < 5; ++i) {
+                list.EmplaceFront(&copies, &moves);
+            }
+            return list;
+        };
+        SingleLinkedList<CopyCounter> list = make_list();
+        assert(list.GetSize() == 5u);
+
+        SingleLinkedList<CopyCounter> moved(std::move(list));
+        assert(moved.GetSize() == 5u);
+        assert(list.IsEmpty() && list.begin() == list.end());
+
+        list = std::move(moved);
+        assert(list.GetSize() == 5u);
+        assert(moved.IsEmpty());
+        assert(copies == 0 && moves == 0);
+
+        // Список, из которого переместили элементы, остаётся пригодным к использованию
+        moved.EmplaceFront(&copies, &moves);
+        assert(moved.GetSize() == 1u);
+    }
+
+    // Элементы, которые можно только перемещать
+    {
+        SingleLinkedList<std::unique_ptr<int>> list;
+        list.PushFront(std::make_unique<int>(3));
+        assert(*list.EmplaceFront(new int(0)) == 0);
+        const auto pos = list.InsertAfter(list.cbegin(), std::make_unique<int>(1));
+        list.EmplaceAfter(pos, std::make_unique<int>(2));
+        int expected = 0;
+        for (const auto& ptr : list) {
+            assert(*ptr == expected++);
+        }
+        assert(expected == 4);
+
+        SingleLinkedList<std::unique_ptr<int>> other;
+        other = std::move(list);
+        assert(other.GetSize() == 4u && list.IsEmpty());
+    }
+
+    // Перемещающее присваивание между списками с разными пулами
+    {
+        SingleLinkedList<std::string, PoolAllocator<std::string>> lhs{"a"};
+        SingleLinkedList<std::string, PoolAllocator<std::string>> rhs{"b", "c"};
+        const auto rhs_alloc = rhs.get_allocator();
+        lhs = std::move(rhs);
+        assert((lhs == SingleLinkedList<std::string, PoolAllocator<std::string>>{"b", "c"}));
+        assert(lhs.get_allocator() == rhs_alloc);
+        assert(rhs.IsEmpty());
+    }
+
+    // Сортировка слиянием
+    {
+        SingleLinkedList<int> empty;
+        empty.Sort();
+        assert(empty.IsEmpty());
+
+        SingleLinkedList<int> numbers{5, 3, 9, 1, 3, 7, 0};
+        const int* first_address = &*numbers.begin();
+        numbers.Sort();
+        assert((numbers == SingleLinkedList<int>{0, 1, 3, 3, 5, 7, 9}));
+        assert(numbers.GetSize() == 7u);
+        // Элементы не копируются: узел со значением 5 просто перецеплен
+        assert(&*std::find(numbers.begin(), numbers.end(), 5) == first_address);
+
+        numbers.Sort(std::greater<>());
+        assert((numbers == SingleLinkedList<int>{9, 7, 5, 3, 3, 1, 0}));
+
+        // Сортировка устойчива: элементы с равными ключами сохраняют исходный порядок
+        std::mt19937 generator(42);
+        std::vector<std::pair<int, int>> expected;
+        SingleLinkedList<std::pair<int, int>> pairs;
+        for (int i = 0; i < 1000; ++i) {
+            expected.emplace_back(static_cast<int>(generator() % 50), i);
+        }
+        pairs.CreateLinkedList(expected.begin(), expected.end());
+        const auto by_key = [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        };
+        pairs.Sort(by_key);
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+        assert(std::equal(pairs.begin(), pairs.end(), expected.begin(), expected.end()));
+    }
+
+    // Слияние отсортированных списков
+    {
+        SingleLinkedList<int> lhs{1, 3, 5, 7};
+        SingleLinkedList<int> rhs{0, 3, 4, 8, 9};
+        lhs.Merge(rhs);
+        assert((lhs == SingleLinkedList<int>{0, 1, 3, 3, 4, 5, 7, 8, 9}));
+        assert(lhs.GetSize() == 9u);
+        assert(rhs.IsEmpty() && rhs.begin() == rhs.end());
+
+        lhs.Merge(SingleLinkedList<int>{2, 10});
+        assert((lhs == SingleLinkedList<int>{0, 1, 2, 3, 3, 4, 5, 7, 8, 9, 10}));
+    }
+
+    // Перенос узлов между списками
+    {
+        SingleLinkedList<int> lhs{1, 2, 3};
+        SingleLinkedList<int> rhs{10, 20, 30, 40};
+
+        lhs.SpliceAfter(lhs.cbegin(), rhs, rhs.cbegin());
+        assert((lhs == SingleLinkedList<int>{1, 20, 2, 3}));
+        assert((rhs == SingleLinkedList<int>{10, 30, 40}));
+
+        lhs.SpliceAfter(lhs.cbefore_begin(), rhs, rhs.cbefore_begin(), ++rhs.cbegin());
+        assert((lhs == SingleLinkedList<int>{10, 1, 20, 2, 3}));
+        assert((rhs == SingleLinkedList<int>{30, 40}));
+
+        lhs.SpliceAfter(lhs.cbegin(), rhs);
+        assert((lhs == SingleLinkedList<int>{10, 30, 40, 1, 20, 2, 3}));
+        assert(lhs.GetSize() == 7u && rhs.IsEmpty());
+
+        // Перенос внутри одного списка
+        lhs.SpliceAfter(lhs.cbefore_begin(), lhs, lhs.cbegin());
+        assert((lhs == SingleLinkedList<int>{30, 10, 40, 1, 20, 2, 3}));
+        assert(lhs.GetSize() == 7u);
+
+        lhs.SpliceAfter(lhs.cbefore_begin(), SingleLinkedList<int>{-1, -2});
+        assert((lhs == SingleLinkedList<int>{-1, -2, 30, 10, 40, 1, 20, 2, 3}));
+    }
+
+    // Очистка списка разрушает все элементы
+    {
+        int deletion_counter = 0;
+        {
+            SingleLinkedList<DeletionSpy> list;
+            for (int i = 0; i < 10; ++i) {
+                list.PushFront(DeletionSpy{});
+                list.begin()->deletion_counter_ptr = &deletion_counter;
+            }
+            list.Clear();
+            assert(deletion_counter == 10);
+            assert(list.IsEmpty() && list.begin() == list.end());
+
+            list.PushFront(DeletionSpy{});
+            list.begin()->deletion_counter_ptr = &deletion_counter;
+        }
+        assert(deletion_counter == 11);
+    }
+
+    // Очистка списка с пулом освобождает блоки целиком, только если все узлы пула принадлежат списку
+    {
+        PoolAllocator<int> alloc(std::make_shared<NodePool>(16));
+        const auto& pool = alloc.GetPool();
+        SingleLinkedList<int, PoolAllocator<int>> lhs(alloc);
+        SingleLinkedList<int, PoolAllocator<int>> rhs(alloc);
+        for (int i = 0; i < 100; ++i) {
+            lhs.PushFront(i);
+        }
+        rhs.PushFront(1);
+        assert(pool->GetBlockCount() == 7u);
+
+        lhs.Clear();
+        assert(lhs.IsEmpty());
+        assert(pool->GetLiveCount() == 1u);
+        assert(pool->GetBlockCount() == 7u);
+        assert((rhs == SingleLinkedList<int, PoolAllocator<int>>({1}, alloc)));
+
+        for (int i = 0; i < 100; ++i) {
+            lhs.PushFront(i);
+        }
+        rhs.Clear();
+        lhs.Clear();
+        assert(pool->GetLiveCount() == 0u);
+        assert(pool->GetBlockCount() == 1u);
+
+        lhs.PushFront(5);
+        assert(*lhs.begin() == 5 && pool->GetLiveCount() == 1u);
+    }
+
+    // Отложенная очистка в фоновом потоке
+    {
+        int deletion_counter = 0;
+        BackgroundReclaimer reclaimer;
+        SingleLinkedList<DeletionSpy> list;
+        for (int i = 0; i < 10; ++i) {
+            list.PushFront(DeletionSpy{});
+            list.begin()->deletion_counter_ptr = &deletion_counter;
+        }
+        list.ClearDeferred(reclaimer);
+        assert(list.IsEmpty() && list.begin() == list.end());
+        reclaimer.Wait();
+        assert(deletion_counter == 10);
+    }
+
+    // Присваивание с переиспользованием узлов
+    {
+        SingleLinkedList<int> lst{1, 2, 3};
+        const int* first_address = &*lst.begin();
+
+        const std::vector<int> longer{4, 5, 6, 7, 8};
+        lst.Assign(longer.begin(), longer.end());
+        assert((lst == SingleLinkedList<int>{4, 5, 6, 7, 8}));
+        assert(lst.GetSize() == 5u);
+        assert(&*lst.begin() == first_address);
+
+        lst.Assign({9, 10});
+        assert((lst == SingleLinkedList<int>{9, 10}));
+        assert(lst.GetSize() == 2u);
+        assert(&*lst.begin() == first_address);
+
+        lst.Assign(longer.end(), longer.end());
+        assert(lst.IsEmpty() && lst.begin() == lst.end());
+
+        // Однопроходные итераторы
+        std::istringstream input("1 2 3 4");
+        lst.Assign(std::istream_iterator<int>(input), std::istream_iterator<int>());
+        assert((lst == SingleLinkedList<int>{1, 2, 3, 4}));
+        assert(lst.GetSize() == 4u);
+        std::istringstream shorter("5 6");
+        lst.Assign(std::istream_iterator<int>(shorter), std::istream_iterator<int>());
+        assert((lst == SingleLinkedList<int>{5, 6}));
+        assert(lst.GetSize() == 2u);
+
+        // Копирующее присваивание тоже переиспользует узлы
+        const SingleLinkedList<int> source(longer.begin(), longer.end());
+        first_address = &*lst.begin();
+        lst = source;
+        assert(lst == source && lst.GetSize() == 5u);
+        assert(&*lst.begin() == first_address);
+    }
+
+    // Присваивание списков, разделяющих пул, выделяет узлы только под разницу длин
+    {
+        PoolAllocator<int> alloc;
+        SingleLinkedList<int, PoolAllocator<int>> lhs({1, 2, 3}, alloc);
+        const SingleLinkedList<int, PoolAllocator<int>> rhs({4, 5, 6, 7}, alloc);
+        lhs = rhs;
+        assert(lhs == rhs);
+        assert(alloc.GetPool()->GetLiveCount() == 8u);
+
+        // Списки с разными пулами: lhs переходит на пул rhs
+        SingleLinkedList<int, PoolAllocator<int>> other{1};
+        other = rhs;
+        assert(other == rhs && other.get_allocator() == alloc);
+
+        // Аллокатор переходит к списку вместе с узлами, даже если при обмене он не передаётся
+        using Alloc = CopyPropagatingPoolAllocator<int>;
+        Alloc lhs_alloc;
+        const Alloc rhs_alloc;
+        {
+            SingleLinkedList<int, Alloc, true> target({1, 2}, lhs_alloc);
+            const SingleLinkedList<int, Alloc, true> source({3, 4, 5}, rhs_alloc);
+            target = source;
+            assert(target == source && target.back() == 5);
+            assert(target.get_allocator() == rhs_alloc);
+            assert(lhs_alloc.GetPool()->GetLiveCount() == 0u);
+            assert(rhs_alloc.GetPool()->GetLiveCount() == 6u);
+        }
+        assert(rhs_alloc.GetPool()->GetLiveCount() == 0u);
+    }
+
+    // Строгая гарантия при присваивании элементов, копирование которых может выбросить исключение
+    {
+        bool exception_was_thrown = false;
+        for (int max_copy_counter = 10; max_copy_counter >= 0; --max_copy_counter) {
+            SingleLinkedList<ThrowOnCopy> list{ThrowOnCopy{}, ThrowOnCopy{}};
+            int copy_counter = max_copy_counter;
+            const SingleLinkedList<ThrowOnCopy> source{ThrowOnCopy(copy_counter), ThrowOnCopy(copy_counter),
+                                                       ThrowOnCopy(copy_counter)};
+            try {
+                list.AssignStrong(source.begin(), source.end());
+                assert(list.GetSize() == 3u);
+            } catch (const std::bad_alloc&) {
+                exception_was_thrown = true;
+                assert(list.GetSize() == 2u);
+                assert(list.begin()->countdown_ptr == nullptr);
+                break;
+            }
+        }
+        assert(exception_was_thrown);
+    }
+}
+
+// Проверяет, что back() ссылается на последний элемент списка
+template <typename List>
+void AssertTail(List& list) {
+    if (list.IsEmpty()) {
+        return;
+    }
+    auto last = list.begin();
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        last = it;
+    }
+    assert(&list.back() == &*last);
+}
+
+// Проверка режима с указателем на последний элемент
+void TestTailTracking() {
+    using Queue = SingleLinkedList<int, std::allocator<int>, true>;
+    static_assert(sizeof(Queue) == sizeof(SingleLinkedList<int>) + sizeof(void*));
+
+    Queue queue;
+    queue.PushBack(1);
+    AssertTail(queue);
+    queue.PushBack(2);
+    queue.EmplaceBack(3);
+    assert((queue == Queue{1, 2, 3}));
+    assert(queue.front() == 1 && queue.back() == 3);
+
+    // Очередь FIFO
+    queue.PopFront();
+    queue.PushBack(4);
+    assert((queue == Queue{2, 3, 4}));
+    AssertTail(queue);
+
+    // Вставка после последнего элемента и удаление последнего элемента
+    auto last = queue.InsertAfter(++(++queue.cbegin()), 5);
+    assert(&*last == &queue.back());
+    queue.EraseAfter(++(++queue.cbegin()));
+    assert(queue.back() == 4);
+    queue.InsertAfter(queue.cbegin(), 10);
+    AssertTail(queue);
+
+    // Удаление всех элементов
+    while (!queue.IsEmpty()) {
+        queue.PopFront();
+    }
+    queue.PushBack(7);
+    assert(queue.front() == 7 && queue.back() == 7);
+    queue.PushFront(6);
+    assert(queue.back() == 7);
+    queue.Clear();
+    queue.PushBack(8);
+    assert((queue == Queue{8}));
+    AssertTail(queue);
+
+    // Создание, копирование, обмен и перемещение
+    Queue created;
+    const std::vector<int> values{1, 2, 3};
+    created.CreateLinkedList(values.begin(), values.end());
+    assert(created.back() == 3);
+    Queue copy(created);
+    assert(copy.back() == 3 && &copy.back() != &created.back());
+    copy.swap(queue);
+    assert(copy.back() == 8 && queue.back() == 3);
+    Queue moved(std::move(queue));
+    assert(moved.back() == 3);
+    queue.PushBack(1);
+    assert((queue == Queue{1}));
+    AssertTail(queue);
+    moved = std::move(copy);
+    assert(moved.back() == 8);
+    AssertTail(moved);
+    copy.PushBack(2);
+    AssertTail(copy);
+
+    // Присваивание
+    queue.Assign({5, 6, 7, 8});
+    assert(queue.back() == 8);
+    queue.Assign({1, 2});
+    assert(queue.back() == 2);
+    AssertTail(queue);
+    queue = created;
+    assert(queue.back() == 3);
+    AssertTail(queue);
+
+    // Сортировка, слияние и перенос узлов
+    queue.Assign({5, 1, 4, 2});
+    queue.Sort();
+    assert(queue.back() == 5);
+    AssertTail(queue);
+    Queue other{3, 6, 7};
+    queue.Merge(other);
+    assert(queue.back() == 7 && other.IsEmpty());
+    AssertTail(queue);
+    other.PushBack(0);
+    assert(other.back() == 0);
+    Queue smaller{0};
+    queue.Merge(smaller);
+    assert(queue.back() == 7);
+    AssertTail(queue);
+
+    Queue donor{100, 200};
+    queue.SpliceAfter(queue.cbefore_begin(), donor, donor.cbegin());
+    assert(donor.back() == 100 && queue.back() == 7);
+    AssertTail(donor);
+    auto before_last = queue.cbegin();
+    for (size_t i = 2; i < queue.GetSize(); ++i) {
+        ++before_last;
+    }
+    donor.SpliceAfter(donor.cbegin(), queue, before_last);
+    assert(donor.back() == 7);
+    AssertTail(queue);
+    AssertTail(donor);
+    queue.SpliceAfter(++queue.cbegin(), donor);
+    AssertTail(queue);
+    AssertTail(donor);
+    assert(donor.IsEmpty());
+    donor.PushBack(1);
+    assert(donor.front() == 1 && donor.back() == 1);
+}
+
+// Проверяет UnrolledSingleLinkedList, сравнивая результат случайных операций с вектором
+template <size_t ChunkSize>
+void TestUnrolledList() {
+    using List = UnrolledSingleLinkedList<std::string, ChunkSize>;
+
+    {
+        List lst{"1", "2", "3", "4", "5"};
+        assert(lst.GetSize() == 5u);
+        assert(++lst.before_begin() == lst.begin());
+        assert(lst.before_begin() == lst.cbefore_begin());
+
+        const auto pos = lst.InsertAfter(lst.cbegin(), "10");
+        assert(*pos == "10");
+        assert((lst == List{"1", "10", "2", "3", "4", "5"}));
+
+        const auto after_erased = lst.EraseAfter(lst.cbegin());
+        assert(*after_erased == "2");
+        lst.PopFront();
+        assert((lst == List{"2", "3", "4", "5"}));
+        assert((List{"2", "3"} < lst));
+
+        List copy(lst);
+        List moved(std::move(copy));
+        assert(moved == lst && copy.IsEmpty());
+        lst.Clear();
+        assert(lst.IsEmpty() && lst.begin() == lst.end());
+    }
+
+    std::mt19937 generator(static_cast<unsigned>(ChunkSize));
+    List lst;
+    std::vector<std::string> expected;
+    for (int step = 0; step < 5000; ++step) {
+        const size_t pos = std::uniform_int_distribution<size_t>(0, expected.size())(generator);
+        auto it = lst.cbefore_begin();
+        for (size_t i = 0; i < pos; ++i) {
+            ++it;
+        }
+
+        if (pos < expected.size() && generator() % 5 < 2) {
+            const auto next = lst.EraseAfter(it);
+            expected.erase(expected.begin() + pos);
+            assert(pos == expected.size() ? next == lst.end() : *next == expected[pos]);
+        } else {
+            const std::string value = std::to_string(step);
+            const auto inserted = lst.InsertAfter(it, value);
+            expected.insert(expected.begin() + pos, value);
+            assert(*inserted == value);
+        }
+
+        assert(lst.GetSize() == expected.size());
+        assert(static_cast<size_t>(std::distance(lst.begin(), lst.end())) == expected.size());
+        assert(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+    }
+
+    // Все элементы разрушаются при удалении и очистке
+    {
+        const auto tracker = std::make_shared<int>(0);
+        UnrolledSingleLinkedList<std::shared_ptr<int>, ChunkSize> spies;
+        for (int i = 0; i < 50; ++i) {
+            spies.PushFront(tracker);
+        }
+        spies.PopFront();
+        spies.EraseAfter(spies.cbegin());
+        assert(tracker.use_count() == 49);
+        spies.Clear();
+        assert(tracker.use_count() == 1);
+    }
+
+    // Элемент конструируется прямо в своей позиции, а исключение при конструировании
+    // оставляет список прежним, в том числе когда для вставки пришлось разделить блок
+    {
+        static int moves = 0;
+        struct Element {
+            explicit Element(int val)
+                : value(val) {
+                if (val < 0) {
+                    throw std::bad_alloc();
+                }
+            }
+            Element(Element&& other) noexcept
+                : value(other.value) {
+                ++moves;
+            }
+            int value;
+        };
+        UnrolledSingleLinkedList<Element, ChunkSize> elements;
+        moves = 0;
+        auto tail = elements.cbefore_begin();
+        for (int i = 0; i < 20; ++i) {
+            tail = elements.EmplaceAfter(tail, i);
+        }
+        assert(moves == 0);
+
+        const auto check = [&elements](int size) {
+            int expected = 0;
+            for (const Element& element : elements) {
+                assert(element.value == expected++);
+            }
+            assert(expected == size && elements.GetSize() == static_cast<size_t>(size));
+        };
+        for (int pos = 0; pos <= 20; ++pos) {
+            bool exception_was_thrown = false;
+            try {
+                elements.EmplaceAfter(std::next(elements.cbefore_begin(), pos), -1);
+            } catch (const std::bad_alloc&) {
+                exception_was_thrown = true;
+            }
+            assert(exception_was_thrown);
+            check(20);
+        }
+        elements.EmplaceAfter(std::next(elements.cbefore_begin(), 20), 20);
+        check(21);
+    }
+}
+
+// Нагрузочная проверка ConcurrentSingleLinkedList: несколько потоков одновременно
+// добавляют и извлекают элементы, каждый добавленный элемент должен быть извлечён ровно один раз
+void TestConcurrentList() {
+    constexpr int producer_count = 4;
+    constexpr int consumer_count = 4;
+    constexpr int items_per_producer = 20000;
+    constexpr int total = producer_count * items_per_producer;
+
+    ConcurrentSingleLinkedList<std::unique_ptr<int>> list;
+    std::vector<std::atomic<int>> popped(total);
+    std::atomic<int> popped_count = 0;
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producer_count; ++producer) {
+        threads.emplace_back([&list, producer] {
+            for (int i = 0; i < items_per_producer; ++i) {
+                list.PushFront(std::make_unique<int>(producer * items_per_producer + i));
+            }
+        });
+    }
+    for (int consumer = 0; consumer < consumer_count; ++consumer) {
+        threads.emplace_back([&] {
+            std::unique_ptr<int> value;
+            while (popped_count.load() < total) {
+                if (list.TryPopFront(value)) {
+                    popped[*value].fetch_add(1);
+                    popped_count.fetch_add(1);
+                }
+                // Приблизительный размер не уходит ниже нуля
+                assert(list.GetSize() <= static_cast<size_t>(total));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    assert(list.IsEmpty() && list.GetSize() == 0u);
+    for (const auto& count : popped) {
+        assert(count.load() == 1);
+    }
+
+    std::unique_ptr<int> value;
+    assert(!list.TryPopFront(value));
+    list.EmplaceFront(new int(1));
+    list.PushFront(std::make_unique<int>(2));
+    assert(list.GetSize() == 2u);
+    assert(list.TryPopFront(value) && *value == 2);
+
+    // Если перемещение значения выбросит исключение, извлечённый узел всё равно освобождается
+    // Узел освобождается указателями опасности, возможно уже при завершении потока,
+    // поэтому счётчик живых значений статический
+    static int live = 0;
+    struct ThrowOnMoveAssign {
+        ThrowOnMoveAssign() noexcept {
+            ++live;
+        }
+        ThrowOnMoveAssign(const ThrowOnMoveAssign&) = delete;
+        ThrowOnMoveAssign& operator=(ThrowOnMoveAssign&&) {
+            throw std::runtime_error("move");
+        }
+        ~ThrowOnMoveAssign() {
+            --live;
+        }
+    };
+    {
+        ConcurrentSingleLinkedList<ThrowOnMoveAssign> throwing;
+        throwing.EmplaceFront();
+        ThrowOnMoveAssign target;
+        bool exception_was_thrown = false;
+        try {
+            throwing.TryPopFront(target);
+        } catch (const std::runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown && throwing.IsEmpty() && throwing.GetSize() == 0u);
+    }
+    // Узел либо уже удалён, либо ждёт в очереди отложенного освобождения
+    assert(live <= 1);
+}
+
+// Проверка интрузивного списка: элементы не копируются и не разрушаются списком
+void TestIntrusiveList() {
+    struct Item {
+        explicit Item(int val, int* counter = nullptr)
+            : value(val)
+            , deletion_counter_ptr(counter) {
+        }
+        Item(const Item&) = delete;
+        Item& operator=(const Item&) = delete;
+        ~Item() {
+            if (deletion_counter_ptr) {
+                ++(*deletion_counter_ptr);
+            }
+        }
+        bool operator==(const Item& rhs) const {
+            return value == rhs.value;
+        }
+        bool operator<(const Item& rhs) const {
+            return value < rhs.value;
+        }
+
+        int value;
+        int* deletion_counter_ptr;
+        IntrusiveListHook hook;
+        IntrusiveListHook other_hook;
+    };
+    using List = IntrusiveSingleLinkedList<Item, &Item::hook>;
+
+    int deletion_counter = 0;
+    {
+        Item a(1, &deletion_counter);
+        Item b(2, &deletion_counter);
+        Item c(3, &deletion_counter);
+        {
+            List list;
+            assert(++list.before_begin() == list.begin());
+            assert(list.before_begin() == list.cbefore_begin());
+
+            list.PushFront(c);
+            list.PushFront(a);
+            const auto inserted = list.InsertAfter(list.cbegin(), b);
+            assert(&*inserted == &b);
+            assert(inserted->value == 2);
+            assert(list.GetSize() == 3u);
+            assert(&*list.begin() == &a);
+
+            int expected = 1;
+            for (const Item& item : list) {
+                assert(item.value == expected++);
+            }
+
+            // Удаление только отцепляет элемент
+            const auto after_erased = list.EraseAfter(list.cbegin());
+            assert(&*after_erased == &c);
+            assert(list.GetSize() == 2u);
+            assert(deletion_counter == 0);
+
+            // Отцеплённый элемент можно вставить снова
+            list.InsertAfter(list.cbefore_begin(), b);
+            assert(list.begin()->value == 2);
+
+            // Один элемент может состоять в разных списках через разные поля-связи
+            IntrusiveSingleLinkedList<Item, &Item::other_hook> other;
+            other.PushFront(a);
+            other.PushFront(c);
+            assert(other.begin()->value == 3 && (++other.begin())->value == 1);
+
+            List moved(std::move(list));
+            assert(moved.GetSize() == 3u && list.IsEmpty());
+            moved.PopFront();
+            list.PushFront(b);
+            assert(moved.GetSize() == 2u && list.GetSize() == 1u);
+        }
+        // Разрушение списков не разрушает элементы
+        assert(deletion_counter == 0);
+    }
+    assert(deletion_counter == 3);
+}
+
+// Проверка параллельных алгоритмов над списком
+void TestParallelAlgorithms() {
+    ThreadPool pool(4);
+
+    SingleLinkedList<int> empty;
+    assert(ParallelReduce(pool, empty, 7, std::plus<>()) == 7);
+    assert(ParallelFindIf(pool, empty, [](int) {
+        return true;
+    }) == empty.end());
+
+    std::vector<int> values(10007);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i);
+    }
+    SingleLinkedList<int> numbers;
+    numbers.CreateLinkedList(values.begin(), values.end());
+
+    ParallelForEach(pool, numbers, [](int& value) {
+        value *= 2;
+    });
+    int expected = 0;
+    for (int value : numbers) {
+        assert(value == expected);
+        expected += 2;
+    }
+
+    const long long sum = ParallelReduce(pool, numbers, 0LL, [](long long lhs, long long rhs) {
+        return lhs + rhs;
+    });
+    assert(sum == 10006LL * 10007LL);
+
+    // Индекс переиспользуется несколькими алгоритмами; порядок объединения частичных результатов сохраняется
+    const SplitIndex<SingleLinkedList<int>> index(numbers, 100);
+    assert(index.GetChunkCount() == 101u);
+    SingleLinkedList<std::string> words;
+    for (int i = 0; i < 1000; ++i) {
+        words.PushFront(std::to_string(i % 10));
+    }
+    const std::string joined = ParallelReduce(pool, SplitIndex(words, 7), std::string(), std::plus<>());
+    assert(joined.size() == words.GetSize());
+    for (size_t i = 0; i < joined.size(); ++i) {
+        assert(joined[i] == '0' + static_cast<int>((999 - i) % 10));
+    }
+
+    // Находится первый подходящий элемент, даже если подходящие есть в нескольких фрагментах
+    const auto found = ParallelFindIf(pool, index, [](int value) {
+        return value >= 5000 && value % 3 == 0;
+    });
+    assert(found != numbers.end() && *found == 5004);
+    const auto not_found = ParallelFindIf(pool, index, [](int value) {
+        return value < 0;
+    });
+    assert(not_found == numbers.end());
+
+    // Вызов из задачи того же пула выполняется в её потоке и не ждёт сам себя
+    ThreadPool single(1);
+    assert(!single.IsWorkerThread());
+    const long long nested_sum = single.Submit([&] {
+        assert(single.IsWorkerThread());
+        return ParallelReduce(single, numbers, 0LL, std::plus<>());
+    }).get();
+    assert(nested_sum == sum);
+}
+
+// Проверка очереди для одного производителя и одного потребителя
+void TestSpscQueue() {
+    {
+        SpscQueue<std::string> queue;
+        std::string value;
+        assert(queue.IsEmpty() && !queue.TryPop(value));
+        queue.Push(std::string("one"));
+        queue.Emplace(3u, 'x');
+        const std::vector<std::string> range = {std::string("a"), std::string("b"), std::string("c")};
+        queue.PushRange(range.begin(), range.end());
+        assert(!queue.IsEmpty());
+        assert(queue.TryPop(value) && value == std::string("one"));
+        assert(queue.TryPop(value) && value == std::string("xxx"));
+
+        std::vector<std::string> popped;
+        assert(queue.PopBatch(std::back_inserter(popped), 2) == 2u);
+        assert((popped == std::vector<std::string>{std::string("a"), std::string("b")}));
+        assert(queue.PopBatch(std::back_inserter(popped), 10) == 1u);
+        assert(popped.back() == std::string("c") && queue.IsEmpty());
+        assert(queue.PopBatch(std::back_inserter(popped), 10) == 0u);
+
+        // Оставшиеся в очереди элементы разрушаются вместе с ней
+        queue.Push(std::string("left"));
+        queue.Push(std::string("behind"));
+    }
+    {
+        // Исключение при конструировании не портит очередь,
+        // а PushRange оставляет элементы, добавленные до исключения
+        struct ThrowingValue {
+            ThrowingValue() = default;
+            ThrowingValue(int val)
+                : value(val) {
+                if (val < 0) {
+                    throw std::bad_alloc();
+                }
+            }
+            int value = 0;
+        };
+
+        SpscQueue<ThrowingValue> queue;
+        ThrowingValue value;
+        for (int round = 0; round < 3; ++round) {
+            try {
+                queue.Emplace(-1);
+                assert(false);
+            } catch (const std::bad_alloc&) {
+            }
+            const std::vector<int> values = {1, 2, -3, 4};
+            try {
+                queue.PushRange(values.begin(), values.end());
+                assert(false);
+            } catch (const std::bad_alloc&) {
+            }
+            assert(queue.TryPop(value) && value.value == 1);
+            assert(queue.TryPop(value) && value.value == 2);
+            assert(!queue.TryPop(value));
+        }
+    }
+    {
+        // Исключение при записи в выходной итератор оставляет очередь согласованной:
+        // извлечённые элементы удалены, остальные по-прежнему доступны
+        static int live = 0;
+        struct Counted {
+            Counted(int val = 0)
+                : value(val) {
+                ++live;
+            }
+            Counted(const Counted& other)
+                : value(other.value) {
+                ++live;
+            }
+            Counted& operator=(const Counted&) = default;
+            ~Counted() {
+                --live;
+            }
+            int value;
+        };
+        struct ThrowingOutput {
+            ThrowingOutput& operator*() {
+                return *this;
+            }
+            ThrowingOutput& operator=(Counted&& counted) {
+                if (*left == 0) {
+                    throw std::runtime_error("output is full");
+                }
+                --*left;
+                received->push_back(counted.value);
+                return *this;
+            }
+            ThrowingOutput& operator++() {
+                return *this;
+            }
+            int* left;
+            std::vector<int>* received;
+        };
+
+        {
+            SpscQueue<Counted> queue;
+            for (int i = 1; i <= 5; ++i) {
+                queue.Emplace(i);
+            }
+            int left = 2;
+            std::vector<int> received;
+            try {
+                queue.PopBatch(ThrowingOutput{&left, &received}, 5);
+                assert(false);
+            } catch (const std::runtime_error&) {
+            }
+            assert((received == std::vector<int>{1, 2}));
+            Counted value;
+            assert(queue.TryPop(value) && value.value == 3);
+            assert(live == 3);
+        }
+        assert(live == 0);
+    }
+    {
+        // Элементы приходят к потребителю ровно один раз и в порядке добавления
+        constexpr int total = 200000;
+        constexpr int batch = 7;
+        SpscQueue<std::unique_ptr<int>> queue;
+        std::thread producer([&queue] {
+            std::vector<int> values;
+            for (int i = 0; i < total;) {
+                if (i % 3 == 0) {
+                    queue.Push(std::make_unique<int>(i++));
+                    continue;
+                }
+                values.clear();
+                for (int j = 0; j < batch && i < total; ++j) {
+                    values.push_back(i++);
+                }
+                std::vector<std::unique_ptr<int>> pointers;
+                for (int v : values) {
+                    pointers.push_back(std::make_unique<int>(v));
+                }
+                queue.PushRange(std::make_move_iterator(pointers.begin()), std::make_move_iterator(pointers.end()));
+            }
+        });
+
+        int expected = 0;
+        std::unique_ptr<int> value;
+        std::vector<std::unique_ptr<int>> popped;
+        while (expected < total) {
+            if (expected % 2 == 0) {
+                if (queue.TryPop(value)) {
+                    assert(*value == expected);
+                    ++expected;
+                }
+                continue;
+            }
+            popped.clear();
+            queue.PopBatch(std::back_inserter(popped), batch);
+            for (const auto& ptr : popped) {
+                assert(*ptr == expected);
+                ++expected;
+            }
+        }
+        producer.join();
+        assert(queue.IsEmpty());
+    }
+}
+
+// Списки, построенные и изменённые на этапе компиляции
+constexpr int SumAfterEdits() {
+    SingleLinkedList<int> list{3, 4};
+    list.PushFront(2);
+    list.PushFront(1);
+    auto it = list.InsertAfter(list.cbegin(), 10);
+    list.EraseAfter(it);
+    list.Sort();
+    SingleLinkedList<int> copy = list;
+    copy.PopFront();
+    if (!(list == SingleLinkedList<int>{1, 3, 4, 10}) || !(list < copy) || copy.GetSize() != 3u) {
+        return -1;
+    }
+    int sum = 0;
+    for (int value : list) {
+        sum += value;
+    }
+    return sum;
+}
+
+static_assert(SumAfterEdits() == 18);
+
+constexpr StaticSingleLinkedList<int, 4> MakeStaticTable() {
+    StaticSingleLinkedList<int, 4> table{2, 3, 4};
+    table.PopFront();
+    table.PushFront(1);
+    table.InsertAfter(table.cbefore_begin(), 0);
+    table.EraseAfter(table.cbegin());
+    return table;
+}
+
+static constexpr StaticSingleLinkedList<int, 4> kStaticTable = MakeStaticTable();
+static_assert(kStaticTable.GetSize() == 3u && kStaticTable.front() == 0);
+static_assert(kStaticTable == StaticSingleLinkedList<int, 4>{0, 3, 4});
+static_assert(kStaticTable < StaticSingleLinkedList<int, 4>{0, 3, 5});
+static_assert(*std::next(kStaticTable.begin(), 2) == 4);
+
+// Проверка списка фиксированной ёмкости во время выполнения
+void TestStaticList() {
+    StaticSingleLinkedList<std::string, 3> list;
+    assert(list.IsEmpty() && list.GetCapacity() == 3u);
+    list.PushFront("c");
+    list.EmplaceFront(2u, 'b');
+    list.InsertAfter(list.cbegin(), "x");
+    assert((list == StaticSingleLinkedList<std::string, 3>{"bb", "x", "c"}));
+
+    bool exception_was_thrown = false;
+    try {
+        list.PushFront("overflow");
+    } catch (const std::length_error&) {
+        exception_was_thrown = true;
+    }
+    assert(exception_was_thrown && list.GetSize() == 3u);
+
+    // Освобождённые ячейки переиспользуются
+    for (int i = 0; i < 10; ++i) {
+        list.EraseAfter(list.cbegin());
+        list.InsertAfter(list.cbegin(), std::to_string(i));
+    }
+    assert((list == StaticSingleLinkedList<std::string, 3>{"bb", "9", "c"}));
+
+    auto copy = list;
+    copy.PopFront();
+    *copy.begin() = "y";
+    assert(*std::next(list.begin()) == "9");
+    swap(list, copy);
+    assert((list == StaticSingleLinkedList<std::string, 3>{"y", "c"}) && copy.GetSize() == 3u);
+
+    list.Clear();
+    assert(list.IsEmpty() && list.begin() == list.end());
+    const std::vector<std::string> words = {"a", "b"};
+    StaticSingleLinkedList<std::string, 3> from_range(words.begin(), words.end());
+    assert(from_range.front() == "a" && from_range.GetSize() == 2u);
+}
+
+// Проверка компактного списка с 32-битными индексами вместо указателей
+void TestCompactList() {
+    struct Point {
+        int x = 0;
+        int y = 0;
+        bool operator==(const Point& rhs) const {
+            return x == rhs.x && y == rhs.y;
+        }
+    };
+
+    CompactSingleLinkedList<Point> points;
+    assert(points.IsEmpty() && points.begin() == points.end());
+    points.PushFront({3, 4});
+    points.EmplaceFront(Point{1, 2});
+    auto it = points.InsertAfter(points.cbegin(), {5, 6});
+    assert(it->x == 5 && points.GetSize() == 3u);
+    assert((std::vector<Point>(points.begin(), points.end()) == std::vector<Point>{{1, 2}, {5, 6}, {3, 4}}));
+
+    // Удалённые ячейки переиспользуются, итераторы остаются действительными при росте массивов
+    points.EraseAfter(points.cbegin());
+    points.PopFront();
+    auto last = points.begin();
+    for (int i = 0; i < 1000; ++i) {
+        points.InsertAfter(points.cbefore_begin(), {i, i});
+    }
+    assert(last->x == 3 && points.front().x == 999 && points.GetSize() == 1001u);
+
+    CompactSingleLinkedList<int> numbers{1, 2, 3};
+    CompactSingleLinkedList<int> copy = numbers;
+    *copy.begin() = 0;
+    assert((numbers == CompactSingleLinkedList<int>{1, 2, 3}) && copy < numbers);
+    CompactSingleLinkedList<int> moved = std::move(copy);
+    assert(copy.IsEmpty() && moved.front() == 0);
+    swap(moved, numbers);
+    assert(moved.front() == 1 && numbers.front() == 0);
+    numbers.Clear();
+    assert(numbers.IsEmpty() && numbers.begin() == numbers.end());
+    numbers.PushFront(7);
+    assert(numbers.front() == 7 && numbers.GetSize() == 1u);
+}
+
+// Проверка сохранения списка в двоичный образ, восстановления и отображения образа в память
+void TestSerialization() {
+    struct Record {
+        std::int64_t id;
+        char tag;
+        bool operator==(const Record& rhs) const {
+            return id == rhs.id && tag == rhs.tag;
+        }
+    };
+
+    SingleLinkedList<Record> records;
+    for (int i = 0; i < 10000; ++i) {
+        records.PushFront({i, static_cast<char>('a' + i % 26)});
+    }
+    std::stringstream image;
+    records.Serialize(image);
+    assert(SingleLinkedList<Record>::Deserialize(image) == records);
+
+    SingleLinkedList<int, std::allocator<int>, true> empty;
+    std::stringstream empty_image;
+    empty.Serialize(empty_image);
+    auto restored_empty = decltype(empty)::Deserialize(empty_image);
+    assert(restored_empty.IsEmpty());
+    restored_empty.PushBack(1);
+    assert(restored_empty.back() == 1);
+
+    {
+        std::stringstream input;
+        SingleLinkedList<int, std::allocator<int>, true>{1, 2, 3}.Serialize(input);
+        auto queue = decltype(empty)::Deserialize(input);
+        queue.PushBack(4);
+        assert((queue == SingleLinkedList<int, std::allocator<int>, true>{1, 2, 3, 4}) && queue.back() == 4);
+    }
+
+    // Повреждённый, обрезанный и чужой образы отвергаются
+    const auto rejects = [](const std::string& bytes) {
+        std::stringstream input(bytes);
+        try {
+            SingleLinkedList<Record>::Deserialize(input);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+    const std::string valid = image.str();
+    assert(rejects(valid.substr(0, valid.size() - 1)));
+    assert(rejects("garbage"));
+    std::string corrupted = valid;
+    corrupted[0] = 'X';
+    assert(rejects(corrupted));
+    std::stringstream int_image;
+    SingleLinkedList<int>{1, 2}.Serialize(int_image);
+    assert(rejects(int_image.str()));
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "single-linked-list-test.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        records.Serialize(file);
+    }
+    {
+        MappedSingleLinkedList<Record> mapped(path.string());
+        assert(mapped.GetSize() == records.GetSize() && mapped.front() == records.front());
+        assert(std::equal(mapped.begin(), mapped.end(), records.begin(), records.end()));
+        MappedSingleLinkedList<Record> moved = std::move(mapped);
+        assert(mapped.IsEmpty() && mapped.begin() == mapped.end() && moved.GetSize() == 10000u);
+
+        bool exception_was_thrown = false;
+        try {
+            MappedSingleLinkedList<int> wrong_type(path.string());
+        } catch (const std::runtime_error&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown);
+    }
+    // Запись занимает ровно столько, сколько значение
+    assert(valid.size() == SerializedListLayout<Record>::kFirstOffset + records.GetSize() * sizeof(Record));
+    assert(int_image.str().size() == SerializedListLayout<int>::kFirstOffset + 2 * sizeof(int));
+    {
+        std::ofstream file(path, std::ios::binary);
+        SingleLinkedList<Record>().Serialize(file);
+    }
+    assert(MappedSingleLinkedList<Record>(path.string()).IsEmpty());
+    std::filesystem::remove(path);
+
+    bool exception_was_thrown = false;
+    try {
+        MappedSingleLinkedList<Record> missing(path.string());
+    } catch (const std::system_error&) {
+        exception_was_thrown = true;
+    }
+    assert(exception_was_thrown);
+}
+
+// Проверка политики статистики: счётчики событий списка, сумма по потокам и обработчик выгрузки
+void TestListStats() {
+    struct TestTag {};
+    using Stats = ListStats<TestTag>;
+    using List = SingleLinkedList<int, std::allocator<int>, false, Stats>;
+
+    // Включённая статистика хранит счётчики вне списка, поэтому не увеличивает его
+    static_assert(sizeof(SingleLinkedList<int>) == sizeof(List));
+    // и не мешает вычислениям на этапе компиляции
+    static_assert([] {
+        List list{1, 2};
+        return *++list.begin();
+    }() == 2);
+
+    const ListStatsSnapshot before = Stats::GetSnapshot();
+    {
+        List list{1, 2, 3};
+        list.PushFront(0);
+        list.InsertAfter(list.cbegin(), 5);
+        list.EraseAfter(list.cbegin());
+        List copy = list;
+        assert(list == copy && !(list < copy));
+        int sum = 0;
+        for (int value : list) {
+            sum += value;
+        }
+        assert(sum == 6);
+        list.Clear();
+    }
+    const ListStatsSnapshot delta = Stats::GetSnapshot() - before;
+    // 3 узла из initializer_list, PushFront, InsertAfter и 4 узла копии
+    assert(delta.node_allocations == 9u);
+    assert(delta.node_deallocations == 9u && delta.GetLiveNodes() == 0);
+    assert(delta.copy_constructions == 1u);
+    assert(delta.comparisons == 2u);
+    // operator== и operator< обходят оба списка по четыре элемента через Mismatch,
+    // ещё четыре перехода делает цикл (и ещё сколько-то — копирующий конструктор)
+    assert(delta.iterator_increments >= 20u);
+
+    // Счётчики завершившихся потоков не теряются
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            List list;
+            for (int i = 0; i < 1000; ++i) {
+                list.PushFront(i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const ListStatsSnapshot after_threads = Stats::GetSnapshot() - before;
+    assert(after_threads.node_allocations == 4009u && after_threads.GetLiveNodes() == 0);
+
+    ListStatsSnapshot dumped;
+    Stats::SetDumpHook([&dumped](const ListStatsSnapshot& snapshot) {
+        dumped = snapshot;
+    });
+    Stats::Dump();
+    assert(dumped.node_allocations == Stats::GetSnapshot().node_allocations);
+    Stats::SetDumpHook(nullptr);
+
+    std::ostringstream output;
+    output << after_threads;
+    assert(output.str().find("node_allocations=4009") != std::string::npos);
+}
+
+// Проверка списка с копированием при записи: копии независимы, но разделяют неизменённые узлы
+void TestCowList() {
+    using List = CowSingleLinkedList<std::string>;
+    const auto to_vector = [](const List& list) {
+        return std::vector<std::string>(list.begin(), list.end());
+    };
+    using Strings = std::vector<std::string>;
+
+    List original{"a", "b", "c", "d"};
+    const std::string* shared_tail = &*std::next(std::as_const(original).begin(), 3);
+
+    // Вставка и удаление в середине копии копируют только путь до позиции
+    List copy = original;
+    copy.InsertAfter(std::next(copy.cbegin()), "x");
+    copy.EraseAfter(std::next(copy.cbegin(), 3));
+    assert(to_vector(copy) == (Strings{"a", "b", "x", "c"}));
+    assert(to_vector(original) == (Strings{"a", "b", "c", "d"}));
+    assert(copy.GetSize() == 4u && original.GetSize() == 4u);
+
+    List second = original;
+    second.PushFront("z");
+    second.PopFront();
+    second.PopFront();
+    assert(to_vector(second) == (Strings{"b", "c", "d"}));
+    assert(&*std::next(std::as_const(second).begin(), 2) == shared_tail);
+
+    // Запись через изменяющий итератор копирует узлы только до изменяемого
+    List third = original;
+    auto it = std::next(third.begin(), 2);
+    *it = "C";
+    assert(to_vector(third) == (Strings{"a", "b", "C", "d"}));
+    assert(to_vector(original) == (Strings{"a", "b", "c", "d"}));
+    assert(&*std::next(std::as_const(third).begin(), 3) == shared_tail);
+    for (auto& value : third) {
+        value += "!";
+    }
+    assert(to_vector(third) == (Strings{"a!", "b!", "C!", "d!"}));
+    assert(to_vector(original) == (Strings{"a", "b", "c", "d"}));
+
+    // Проход по копии изменяющим итератором копирует каждый узел один раз,
+    // а повторный проход и вставки по пройденному пути ничего не копируют
+    {
+        static int copies = 0;
+        struct CopyCounter {
+            CopyCounter(int val)
+                : value(val) {
+            }
+            CopyCounter(const CopyCounter& other)
+                : value(other.value) {
+                ++copies;
+            }
+            CopyCounter& operator=(const CopyCounter&) = default;
+            int value;
+        };
+        constexpr int size = 2000;
+        CowSingleLinkedList<CopyCounter> shared;
+        for (int i = size - 1; i >= 0; --i) {
+            shared.EmplaceFront(i);
+        }
+        std::vector<const CopyCounter*> shared_nodes;
+        for (const auto& value : std::as_const(shared)) {
+            shared_nodes.push_back(&value);
+        }
+
+        auto detached = shared;
+        int expected = 0;
+        for (auto& value : detached) {
+            assert(value.value == expected++);
+        }
+        assert(copies == size);
+        std::vector<const CopyCounter*> detached_nodes;
+        for (auto& value : detached) {
+            detached_nodes.push_back(&value);
+        }
+        assert(copies == size);
+        for (int i = 0; i < size; ++i) {
+            assert(detached_nodes[i] != shared_nodes[i]);
+        }
+        expected = 0;
+        for (const auto& value : std::as_const(shared)) {
+            assert(&value == shared_nodes[expected++]);
+        }
+
+        // Вставка через итератор, который прошёл разделяемый путь, копирует только этот путь:
+        // по одному исходному узлу и одному вставляемому значению на каждую вставку
+        copies = 0;
+        auto inserting = shared;
+        auto pos = inserting.begin();
+        for (int i = 0; i < size / 2; ++i) {
+            pos = std::next(inserting.InsertAfter(pos, CopyCounter(-1)));
+        }
+        assert(copies == size);
+        assert(inserting.GetSize() == size_t{size + size / 2});
+        expected = 0;
+        for (const auto& value : std::as_const(shared)) {
+            assert(&value == shared_nodes[expected++]);
+        }
+    }
+
+    // Единственный владелец изменяет узлы на месте
+    const std::string* first = &original.front();
+    *original.begin() = "A";
+    original.InsertAfter(original.cbegin(), "ab");
+    assert(&original.front() == first);
+    assert(to_vector(original) == (Strings{"A", "ab", "b", "c", "d"}));
+
+    // Отпускание копий не трогает оставшиеся
+    {
+        List temp = original;
+        temp.Clear();
+        List moved = std::move(second);
+        assert(second.IsEmpty() && moved.GetSize() == 3u);
+    }
+    assert(original.GetSize() == 5u && copy.front() == "a");
+    copy = original;
+    assert(copy == original && !(copy < original));
+    swap(copy, third);
+    assert(copy.front() == "a!" && third == original);
+
+    // Исключение при копировании пути оставляет список прежним
+    struct ThrowingCopy {
+        ThrowingCopy(int val)
+            : value(val) {
+        }
+        ThrowingCopy(const ThrowingCopy& other)
+            : value(other.value) {
+            if (value < 0) {
+                throw std::bad_alloc();
+            }
+        }
+        int value;
+    };
+    CowSingleLinkedList<ThrowingCopy> throwing;
+    throwing.EmplaceFront(1);
+    throwing.EmplaceFront(-1);
+    auto throwing_copy = throwing;
+    bool exception_was_thrown = false;
+    try {
+        throwing_copy.InsertAfter(std::next(throwing_copy.cbegin()), ThrowingCopy(2));
+    } catch (const std::bad_alloc&) {
+        exception_was_thrown = true;
+    }
+    assert(exception_was_thrown && throwing_copy.GetSize() == 2u);
+    assert(&throwing_copy.front() == &throwing.front());
+
+    // Если копирование элемента выбросит исключение при создании списка из интервала,
+    // уже созданные узлы удаляются
+    struct LiveCounter {
+        LiveCounter(int val, int* live_counter) noexcept
+            : value(val)
+            , live(live_counter) {
+            ++*live;
+        }
+        LiveCounter(const LiveCounter& other)
+            : value(other.value)
+            , live(other.live) {
+            if (value < 0) {
+                throw std::bad_alloc();
+            }
+            ++*live;
+        }
+        ~LiveCounter() {
+            --*live;
+        }
+        int value;
+        int* live;
+    };
+    int live = 0;
+    {
+        std::vector<LiveCounter> values{{1, &live}, {2, &live}, {3, &live}, {4, &live}};
+        assert(live == 4);
+        // Третье копирование выбросит исключение
+        values[2].value = -1;
+        exception_was_thrown = false;
+        try {
+            CowSingleLinkedList<LiveCounter> counted(values.begin(), values.end());
+        } catch (const std::bad_alloc&) {
+            exception_was_thrown = true;
+        }
+        assert(exception_was_thrown && live == 4);
+    }
+    assert(live == 0);
+
+    // Копии с общими узлами можно использовать и уничтожать в разных потоках
+    List big;
+    for (int i = 0; i < 1000; ++i) {
+        big.PushFront(std::to_string(i));
+    }
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([big, t]() mutable {
+            for (int i = 0; i < 100; ++i) {
+                List local = big;
+                local.PopFront();
+                *std::next(local.begin(), t) = "changed";
+                local.PushFront("new");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(big.front() == "999" && big.GetSize() == 1000u);
+}
+
+void TestBatchOperations() {
+    using Ints = std::vector<int>;
+    const auto to_vector = [](const auto& list) {
+        return Ints(list.begin(), list.end());
+    };
+
+    // Вставка интервала
+    {
+        SingleLinkedList<int> list{1, 5};
+        const Ints values{2, 3, 4};
+        const auto last = list.InsertAfter(list.cbegin(), values.begin(), values.end());
+        assert(*last == 4);
+        assert(to_vector(list) == (Ints{1, 2, 3, 4, 5}));
+        assert(list.GetSize() == 5u);
+
+        assert(list.InsertAfter(list.cbegin(), values.end(), values.end()) == list.begin());
+        list.InsertAfter(list.cbefore_begin(), {-1, 0});
+        assert(to_vector(list) == (Ints{-1, 0, 1, 2, 3, 4, 5}));
+    }
+
+    // Удаление интервала
+    {
+        SingleLinkedList<int> list{1, 2, 3, 4, 5};
+        const auto after = list.EraseAfter(list.cbegin(), std::next(list.cbegin(), 4));
+        assert(*after == 5);
+        assert(to_vector(list) == (Ints{1, 5}));
+        assert(list.GetSize() == 2u);
+        assert(list.EraseAfter(list.cbegin(), std::next(list.cbegin())) == std::next(list.begin()));
+        list.EraseAfter(list.cbefore_begin(), list.cend());
+        assert(list.IsEmpty() && list.begin() == list.end());
+    }
+
+    // RemoveIf, Remove и Unique
+    {
+        SingleLinkedList<int> list{1, 2, 2, 3, 2, 4, 4, 4, 5, 2};
+        assert(list.Remove(2) == 4u);
+        assert(to_vector(list) == (Ints{1, 3, 4, 4, 4, 5}));
+        assert(list.Unique() == 2u);
+        assert(to_vector(list) == (Ints{1, 3, 4, 5}));
+        assert(list.RemoveIf([](int value) {
+            return value % 2 != 0;
+        }) == 3u);
+        assert(to_vector(list) == (Ints{4}));
+        assert(list.GetSize() == 1u);
+
+        // Значение может ссылаться на удаляемый элемент
+        SingleLinkedList<int> aliased{7, 1, 7, 7};
+        assert(aliased.Remove(aliased.front()) == 3u);
+        assert(to_vector(aliased) == (Ints{1}));
+
+        // Unique с предикатом сравнивает очередной элемент с последним оставленным
+        SingleLinkedList<int> steps{1, 2, 3, 10, 11, 20};
+        assert(steps.Unique([](int kept, int value) {
+            return value - kept < 5;
+        }) == 3u);
+        assert(to_vector(steps) == (Ints{1, 10, 20}));
+    }
+
+    // Последний элемент обновляется при пакетных операциях
+    {
+        SingleLinkedList<int, std::allocator<int>, true> list{1, 2};
+        list.InsertAfter(std::next(list.cbegin()), {3, 4});
+        assert(list.back() == 4);
+        list.EraseAfter(list.cbegin(), list.cend());
+        assert(list.back() == 1);
+        list.InsertAfter(list.cbegin(), {2, 2, 3, 3});
+        list.Unique();
+        assert(list.back() == 3);
+        list.Remove(3);
+        assert(list.back() == 2);
+        list.RemoveIf([](int) {
+            return true;
+        });
+        assert(list.IsEmpty());
+        list.PushBack(8);
+        assert(list.front() == 8 && list.back() == 8);
+    }
+
+    // Строгая гарантия безопасности исключений при вставке интервала
+    {
+        struct ThrowOnCopy {
+            explicit ThrowOnCopy(int id, int* countdown = nullptr) noexcept
+                : id(id)
+                , countdown(countdown) {
+            }
+            ThrowOnCopy(const ThrowOnCopy& other)
+                : id(other.id)
+                , countdown(other.countdown) {
+                if (countdown && (*countdown)-- == 0) {
+                    throw std::bad_alloc();
+                }
+            }
+            int id;
+            int* countdown;
+        };
+
+        SingleLinkedList<ThrowOnCopy> list;
+        list.PushFront(ThrowOnCopy(1));
+        int countdown = -1;
+        const std::vector<ThrowOnCopy> values{ThrowOnCopy(2, &countdown), ThrowOnCopy(3, &countdown),
+                                              ThrowOnCopy(4, &countdown)};
+        // Третье копирование выбросит исключение
+        countdown = 2;
+        try {
+            list.InsertAfter(list.cbegin(), values.begin(), values.end());
+            assert(false);
+        } catch (const std::bad_alloc&) {
+        }
+        assert(list.GetSize() == 1u && list.front().id == 1 && std::next(list.begin()) == list.end());
+    }
+
+    // Если предикат выбросит исключение, отобранные до этого элементы удаляются
+    {
+        SingleLinkedList<int> list{1, 2, 3, 4};
+        try {
+            list.RemoveIf([](int value) {
+                if (value == 3) {
+                    throw std::runtime_error("stop");
+                }
+                return value == 2;
+            });
+            assert(false);
+        } catch (const std::runtime_error&) {
+        }
+        assert(to_vector(list) == (Ints{1, 3, 4}));
+        assert(list.GetSize() == 3u);
+    }
+
+    // Узлы пула возвращаются в него одной цепочкой
+    {
+        PoolAllocator<int> alloc;
+        const auto& pool = alloc.GetPool();
+        {
+            SingleLinkedList<int, PoolAllocator<int>> list(alloc);
+            Ints values(1000);
+            std::iota(values.begin(), values.end(), 0);
+            list.InsertAfter(list.cbefore_begin(), values.begin(), values.end());
+            assert(pool->GetLiveCount() == 1000u);
+
+            list.EraseAfter(list.cbegin(), std::next(list.cbegin(), 101));
+            assert(list.GetSize() == 900u && pool->GetLiveCount() == 900u);
+            assert(list.RemoveIf([](int value) {
+                return value % 3 == 0;
+            }) == 301u);
+            assert(list.GetSize() == 599u && pool->GetLiveCount() == 599u);
+
+            // Освобождённые узлы переиспользуются, новые блоки не выделяются
+            const size_t block_count = pool->GetBlockCount();
+            list.InsertAfter(list.cbefore_begin(), values.begin(), values.begin() + 401);
+            assert(pool->GetLiveCount() == 1000u && pool->GetBlockCount() == block_count);
+            assert(std::is_sorted(list.begin(), std::next(list.begin(), 401)));
+        }
+        assert(pool->GetLiveCount() == 0u);
+
+        // Нетривиально разрушаемые значения разрушаются по одному
+        using StringAllocator = PoolAllocator<std::string>;
+        StringAllocator string_alloc;
+        SingleLinkedList<std::string, StringAllocator> strings({"a", "a", "long string that needs heap", "b"}, string_alloc);
+        assert(strings.Unique() == 1u);
+        assert(strings.Remove("long string that needs heap") == 1u);
+        assert(string_alloc.GetPool()->GetLiveCount() == 2u);
+    }
+}
+
+void TestPrefetchedTraversal() {
+    SingleLinkedList<int> list;
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    list.InsertAfter(list.cbefore_begin(), values.begin(), values.end());
+
+    // Результат не зависит от дальности упреждения, в том числе превышающей длину списка
+    for (size_t distance : {size_t{0}, size_t{1}, SingleLinkedList<int>::kPrefetchDistance, size_t{5000}}) {
+        std::vector<int> visited;
+        list.ForEachPrefetched(
+            [&visited](int& value) {
+                visited.push_back(value++);
+            },
+            distance);
+        assert(visited == values);
+        std::as_const(list).ForEachPrefetched(
+            [](const int& value) {
+                assert(value >= 1);
+            },
+            distance);
+        list.ForEachPrefetched(
+            [](int& value) {
+                --value;
+            },
+            distance);
+
+        assert(list.Find(0, distance) == list.begin());
+        assert(*list.Find(500, distance) == 500);
+        assert(list.Find(1000, distance) == list.end());
+        assert(std::as_const(list).Find(999, distance) == std::next(list.cbegin(), 999));
+        assert(list.Count(7, distance) == 1u && list.Count(-1, distance) == 0u);
+        assert(list.Accumulate(0LL, std::plus<>(), distance) == 999LL * 1000 / 2);
+    }
+
+    *list.Find(3) = 7;
+    assert(list.Count(7) == 2u);
+    assert(list.Accumulate(std::string(), [](std::string result, int value) {
+        return value < 3 ? result + std::to_string(value) : result;
+    }) == "012");
+
+    SingleLinkedList<int> empty;
+    assert(empty.Find(0) == empty.end() && empty.Count(0) == 0u && empty.Accumulate(5) == 5);
+    empty.ForEachPrefetched([](int) {
+        assert(false);
+    });
+
+    // Mismatch и сравнения
+    {
+        const SingleLinkedList<int> lhs{1, 2, 3, 4};
+        const SingleLinkedList<int> rhs{1, 2, 5};
+        const auto [lhs_it, rhs_it] = lhs.Mismatch(rhs);
+        assert(*lhs_it == 3 && *rhs_it == 5);
+        const SingleLinkedList<int> longer{1, 2, 5, 6};
+        const auto [prefix_it, longer_it] = rhs.Mismatch(longer, std::equal_to<>(), 1);
+        assert(prefix_it == rhs.end() && *longer_it == 6);
+
+        assert(lhs < rhs && !(rhs < lhs) && lhs != rhs);
+        assert((SingleLinkedList<int>{1, 2} < SingleLinkedList<int>{1, 2, 0}));
+        assert(!(SingleLinkedList<int>{1, 2} < SingleLinkedList<int>{1, 2}));
+        assert((SingleLinkedList<int>{} < SingleLinkedList<int>{0}));
+        assert(!(SingleLinkedList<int>{0} < SingleLinkedList<int>{}));
+        assert(list == SingleLinkedList<int>(list));
+    }
+
+    // operator< использует только оператор < элементов
+    {
+        struct OnlyLess {
+            int value;
+            bool operator<(const OnlyLess& rhs) const {
+                return value < rhs.value;
+            }
+        };
+        const SingleLinkedList<OnlyLess> lhs{{1}, {2}};
+        const SingleLinkedList<OnlyLess> rhs{{1}, {3}};
+        assert(lhs < rhs && !(rhs < lhs) && lhs <= lhs);
+    }
 }
 
 int main() {
     Test();
+    TestUnrolledList<1>();
+    TestUnrolledList<2>();
+    TestUnrolledList<3>();
+    TestUnrolledList<16>();
+    TestConcurrentList();
+    TestIntrusiveList();
+    TestParallelAlgorithms();
+    TestTailTracking();
+    TestSpscQueue();
+    TestStaticList();
+    TestCompactList();
+    TestSerialization();
+    TestListStats();
+    TestCowList();
+    TestBatchOperations();
+    TestPrefetchedTraversal();
 }
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "serialized-list-format.h"
+
+
+// Представление только для чтения над файлом, записанным SingleLinkedList::Serialize.
+// Файл отображается в память через mmap, так что элементы не копируются и память под них
+// не выделяется: страницы подгружаются операционной системой по мере обхода.
+// Записи лежат подряд, поэтому итератор переходит к следующей записи на её фиксированный размер,
+// а количество записей, проверенное по размеру файла, ограничивает обход пределами отображения
+template <typename Type>
+class MappedSingleLinkedList {
+    using Layout = SerializedListLayout<Type>;
+
+public:
+
+    class ConstIterator {
+        friend class MappedSingleLinkedList;
+
+        ConstIterator(const std::byte* record, const std::byte* records_end) noexcept
+            : record_(record)
+            , records_end_(records_end) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        ConstIterator() = default;
+
+        [[nodiscard]] bool operator==(const ConstIterator& rhs) const noexcept {
+            return record_ == rhs.record_;
+        }
+
+        [[nodiscard]] bool operator!=(const ConstIterator& rhs) const noexcept {
+            return !(record_ == rhs.record_);
+        }
+
+        ConstIterator& operator++() noexcept {
+            assert(record_ != nullptr);
+            record_ += Layout::kRecordSize;
+            if (record_ == records_end_) {
+                record_ = nullptr;
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept {
+            auto past = *this;
+            ++(*this);
+            return past;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            return *operator->();
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return std::launder(reinterpret_cast<const Type*>(record_));
+        }
+
+    private:
+        const std::byte* record_ = nullptr;
+        // Конец последней записи
+        const std::byte* records_end_ = nullptr;
+    };
+
+    using value_type = Type;
+    using const_reference = const value_type&;
+    using Iterator = ConstIterator;
+
+    // Отображает файл path в память. При ошибке открытия или отображения выбрасывает std::system_error,
+    // если файл не является образом списка значений Type — std::runtime_error
+    explicit MappedSingleLinkedList(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "open " + path);
+        }
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "fstat " + path);
+        }
+        if (static_cast<std::uint64_t>(info.st_size) < sizeof(SerializedListHeader)) {
+            ::close(fd);
+            throw std::runtime_error("serialized list header is truncated");
+        }
+
+        mapped_size_ = static_cast<std::size_t>(info.st_size);
+        void* data = ::mmap(nullptr, mapped_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        const int error = errno;
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            throw std::system_error(error, std::generic_category(), "mmap " + path);
+        }
+        data_ = static_cast<const std::byte*>(data);
+
+        SerializedListHeader header;
+        std::memcpy(&header, data_, sizeof(header));
+        try {
+            Layout::Validate(header, mapped_size_);
+        } catch (...) {
+            Unmap();
+            throw;
+        }
+        size_ = static_cast<std::size_t>(header.count);
+    }
+
+    MappedSingleLinkedList(const MappedSingleLinkedList&) = delete;
+    MappedSingleLinkedList& operator=(const MappedSingleLinkedList&) = delete;
+
+    MappedSingleLinkedList(MappedSingleLinkedList&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr))
+        , mapped_size_(std::exchange(other.mapped_size_, 0))
+        , size_(std::exchange(other.size_, 0)) {
+    }
+
+    MappedSingleLinkedList& operator=(MappedSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Unmap();
+            data_ = std::exchange(rhs.data_, nullptr);
+            mapped_size_ = std::exchange(rhs.mapped_size_, 0);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    ~MappedSingleLinkedList() {
+        Unmap();
+    }
+
+    [[nodiscard]] std::size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    // Первый элемент списка. Список не должен быть пустым
+    [[nodiscard]] const Type& front() const noexcept {
+        assert(!IsEmpty());
+        return *begin();
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        if (size_ == 0) {
+            return end();
+        }
+        const std::byte* first = data_ + Layout::kFirstOffset;
+        return ConstIterator(first, first + size_ * Layout::kRecordSize);
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return ConstIterator(nullptr, nullptr);
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    void Unmap() noexcept {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<std::byte*>(data_), mapped_size_);
+            data_ = nullptr;
+        }
+    }
+
+    const std::byte* data_ = nullptr;
+    std::size_t mapped_size_ = 0;
+    std::size_t size_ = 0;
+};
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+// Пул узлов фиксированного размера.
+// Память выделяется крупными непрерывными блоками, освобождённые узлы
+// попадают в список свободных и переиспользуются при следующих выделениях.
+// Размер ячейки фиксируется при первом выделении; запросы, которые в ячейку
+// не помещаются, обслуживаются обычным operator new.
+// Пул не потокобезопасен.
+class NodePool {
+public:
+    explicit NodePool(std::size_t nodes_per_block = 256) noexcept
+        : nodes_per_block_(nodes_per_block == 0 ? 1 : nodes_per_block) {
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    ~NodePool() {
+        for (void* block : blocks_) {
+            ::operator delete(block, std::align_val_t(chunk_align_));
+        }
+    }
+
+    // Выделяет память под один объект размера size с выравниванием alignment
+    [[nodiscard]] void* Allocate(std::size_t size, std::size_t alignment) {
+        if (chunk_size_ == 0) {
+            chunk_align_ = alignment < alignof(FreeChunk) ? alignof(FreeChunk) : alignment;
+            chunk_size_ = size < sizeof(FreeChunk) ? sizeof(FreeChunk) : size;
+            chunk_size_ = (chunk_size_ + chunk_align_ - 1) / chunk_align_ * chunk_align_;
+        }
+        if (!IsPooled(size, alignment)) {
+            return ::operator new(size, std::align_val_t(alignment));
+        }
+
+        if (free_list_ != nullptr) {
+            ++live_count_;
+            return std::exchange(free_list_, free_list_->next);
+        }
+        if (cursor_ == block_end_) {
+            AddBlock();
+        }
+        // Счётчик увеличивается только после того, как AddBlock не выбросил исключение
+        ++live_count_;
+        return std::exchange(cursor_, cursor_ + chunk_size_);
+    }
+
+    // Возвращает в пул память, ранее полученную через Allocate с теми же size и alignment
+    void Deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept {
+        if (!IsPooled(size, alignment)) {
+            ::operator delete(ptr, std::align_val_t(alignment));
+            return;
+        }
+
+        --live_count_;
+        free_list_ = new (ptr) FreeChunk{free_list_};
+    }
+
+    // Возвращает в пул цепочку из count объектов размера size, связанных указателем на следующий объект,
+    // который лежит в начале каждого объекта (последний объект цепочки — last).
+    // Для объектов из пула цепочка присоединяется к списку свободных целиком, без обхода
+    void DeallocateChain(void* first, void* last, std::size_t count, std::size_t size, std::size_t alignment) noexcept {
+        if (!IsPooled(size, alignment)) {
+            while (count-- != 0) {
+                void* next = *static_cast<void**>(first);
+                ::operator delete(first, std::align_val_t(alignment));
+                first = next;
+            }
+            return;
+        }
+
+        live_count_ -= count;
+        new (last) FreeChunk{free_list_};
+        free_list_ = static_cast<FreeChunk*>(first);
+    }
+
+    // Возвращает в пул сразу все выданные узлы размера size, не перебирая их, если их ровно expected_live.
+    // Первый блок сохраняется для последующих выделений, остальные освобождаются.
+    // Объекты в узлах не разрушаются, поэтому владелец должен сделать это сам
+    // или хранить тривиально разрушаемые объекты.
+    // Возвращает false и ничего не меняет, если часть узлов принадлежит кому-то ещё
+    bool TryReleaseAll(std::size_t expected_live, std::size_t size, std::size_t alignment) noexcept {
+        if (!IsPooled(size, alignment) || live_count_ != expected_live || blocks_.empty()) {
+            return false;
+        }
+        for (std::size_t i = 1; i < blocks_.size(); ++i) {
+            ::operator delete(blocks_[i], std::align_val_t(chunk_align_));
+        }
+        blocks_.resize(1);
+        cursor_ = static_cast<std::byte*>(blocks_.front());
+        block_end_ = cursor_ + chunk_size_ * nodes_per_block_;
+        free_list_ = nullptr;
+        live_count_ = 0;
+        return true;
+    }
+
+    // Количество узлов, выданных пулом и ещё не возвращённых
+    [[nodiscard]] std::size_t GetLiveCount() const noexcept {
+        return live_count_;
+    }
+
+    // Количество выделенных блоков
+    [[nodiscard]] std::size_t GetBlockCount() const noexcept {
+        return blocks_.size();
+    }
+
+private:
+    struct FreeChunk {
+        FreeChunk* next = nullptr;
+    };
+
+    [[nodiscard]] bool IsPooled(std::size_t size, std::size_t alignment) const noexcept {
+        return size <= chunk_size_ && alignment <= chunk_align_;
+    }
+
+    void AddBlock() {
+        // Место под указатель на блок резервируется до выделения блока, чтобы push_back не бросал исключений.
+        // Ёмкость растёт вдвое: рост на единицу копировал бы весь массив при каждом новом блоке
+        if (blocks_.size() == blocks_.capacity()) {
+            blocks_.reserve(blocks_.empty() ? 8 : blocks_.size() * 2);
+        }
+        void* block = ::operator new(chunk_size_ * nodes_per_block_, std::align_val_t(chunk_align_));
+        blocks_.push_back(block);
+        cursor_ = static_cast<std::byte*>(block);
+        block_end_ = cursor_ + chunk_size_ * nodes_per_block_;
+    }
+
+    std::size_t nodes_per_block_;
+    std::size_t chunk_size_ = 0;
+    std::size_t chunk_align_ = alignof(FreeChunk);
+    std::vector<void*> blocks_;
+    FreeChunk* free_list_ = nullptr;
+    std::byte* cursor_ = nullptr;
+    std::byte* block_end_ = nullptr;
+    std::size_t live_count_ = 0;
+};
+
+
+// Аллокатор, раздающий одиночные объекты из общего NodePool.
+// Копии аллокатора (в том числе полученные через rebind) разделяют один пул
+template <typename T>
+class PoolAllocator {
+    template <typename U>
+    friend class PoolAllocator;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    PoolAllocator()
+        : pool_(std::make_shared<NodePool>()) {
+    }
+
+    explicit PoolAllocator(std::shared_ptr<NodePool> pool) noexcept
+        : pool_(std::move(pool)) {
+    }
+
+    // Перемещение аллокатора копирует его: исходный аллокатор должен
+    // оставаться равным новому и продолжать обслуживать свой контейнер
+    PoolAllocator(const PoolAllocator&) noexcept = default;
+    PoolAllocator& operator=(const PoolAllocator&) noexcept = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept
+        : pool_(other.pool_) {
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n) {
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+        }
+        return static_cast<T*>(pool_->Allocate(sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept {
+        if (n != 1) {
+            ::operator delete(ptr, std::align_val_t(alignof(T)));
+            return;
+        }
+        pool_->Deallocate(ptr, sizeof(T), alignof(T));
+    }
+
+    // Возвращает в пул цепочку из count объектов от first до last, связанных указателем в начале объекта.
+    // См. NodePool::DeallocateChain
+    void DeallocateChain(T* first, T* last, std::size_t count) noexcept {
+        pool_->DeallocateChain(first, last, count, sizeof(T), alignof(T));
+    }
+
+    // См. NodePool::TryReleaseAll
+    bool TryReleaseAll(std::size_t expected_live) noexcept {
+        return pool_->TryReleaseAll(expected_live, sizeof(T), alignof(T));
+    }
+
+    [[nodiscard]] const std::shared_ptr<NodePool>& GetPool() const noexcept {
+        return pool_;
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator==(const PoolAllocator<U>& rhs) const noexcept {
+        return pool_ == rhs.pool_;
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator!=(const PoolAllocator<U>& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+private:
+    std::shared_ptr<NodePool> pool_;
+};
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "thread-pool.h"
+
+
+// Индекс разбиения списка: итераторы на каждый step-й элемент.
+// Односвязный список нельзя разделить по номеру элемента, поэтому индекс строится
+// одним последовательным проходом и затем переиспользуется параллельными алгоритмами,
+// пока список не изменится. Любая вставка или удаление делают индекс недействительным
+template <typename List>
+class SplitIndex {
+public:
+    using Iterator = decltype(std::declval<List&>().begin());
+
+    SplitIndex(List& list, size_t step)
+        : end_(list.end()) {
+        if (step == 0) {
+            step = 1;
+        }
+        starts_.reserve(list.GetSize() / step + 1);
+        size_t i = 0;
+        for (auto it = list.begin(); it != end_; ++it, ++i) {
+            if (i % step == 0) {
+                starts_.push_back(it);
+            }
+        }
+    }
+
+    // Количество фрагментов, на которые разбит список
+    [[nodiscard]] size_t GetChunkCount() const noexcept {
+        return starts_.size();
+    }
+
+    [[nodiscard]] Iterator ChunkBegin(size_t chunk) const noexcept {
+        return starts_[chunk];
+    }
+
+    [[nodiscard]] Iterator ChunkEnd(size_t chunk) const noexcept {
+        return chunk + 1 < starts_.size() ? starts_[chunk + 1] : end_;
+    }
+
+    [[nodiscard]] Iterator End() const noexcept {
+        return end_;
+    }
+
+private:
+    std::vector<Iterator> starts_;
+    Iterator end_;
+};
+
+// Шаг индекса, при котором на каждый поток пула приходится несколько фрагментов
+template <typename List>
+size_t DefaultSplitStep(const List& list, const ThreadPool& pool) {
+    constexpr size_t chunks_per_thread = 8;
+    return std::max<size_t>(1, list.GetSize() / (pool.GetThreadCount() * chunks_per_thread));
+}
+
+// Выполняет process(chunk) для каждого фрагмента индекса в потоках пула и в вызывающем потоке.
+// Фрагменты раздаются через общий счётчик, поэтому медленный фрагмент не задерживает остальные.
+// Если вызов сделан из задачи того же пула, задачи не ставятся и все фрагменты обрабатываются
+// в вызывающем потоке: ожидание задач, стоящих в очереди за ним самим, могло бы никогда не завершиться
+template <typename List, typename Process>
+void ForEachChunk(ThreadPool& pool, const SplitIndex<List>& index, Process& process) {
+    const size_t chunk_count = index.GetChunkCount();
+    std::atomic<size_t> next_chunk = 0;
+    const auto worker = [&] {
+        for (size_t chunk = next_chunk++; chunk < chunk_count; chunk = next_chunk++) {
+            process(chunk);
+        }
+    };
+
+    const size_t helpers =
+        pool.IsWorkerThread() ? 0 : std::min(pool.GetThreadCount(), chunk_count > 0 ? chunk_count - 1 : 0);
+    std::vector<std::future<void>> results;
+    // Исключение пробрасывается только после завершения всех задач, ссылающихся на локальные данные,
+    // в том числе если Submit выбросит исключение после того, как часть задач уже поставлена
+    std::exception_ptr error;
+    try {
+        results.reserve(helpers);
+        for (size_t i = 0; i < helpers; ++i) {
+            results.push_back(pool.Submit(worker));
+        }
+        worker();
+    } catch (...) {
+        error = std::current_exception();
+        // Оставшиеся фрагменты больше не раздаются, и поставленные задачи завершаются сразу
+        next_chunk = chunk_count;
+    }
+    for (auto& result : results) {
+        try {
+            result.get();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// Применяет function к каждому элементу списка параллельно
+template <typename List, typename Function>
+void ParallelForEach(ThreadPool& pool, const SplitIndex<List>& index, Function function) {
+    auto process = [&](size_t chunk) {
+        std::for_each(index.ChunkBegin(chunk), index.ChunkEnd(chunk), function);
+    };
+    ForEachChunk(pool, index, process);
+}
+
+template <typename List, typename Function>
+void ParallelForEach(ThreadPool& pool, List& list, Function function) {
+    ParallelForEach(pool, SplitIndex<List>(list, DefaultSplitStep(list, pool)), std::move(function));
+}
+
+// Сворачивает элементы списка операцией op, начиная с init. Элементы должны приводиться к T.
+// op должна быть ассоциативной; частичные результаты объединяются в порядке элементов списка,
+// поэтому коммутативность не требуется
+template <typename List, typename T, typename BinaryOp>
+T ParallelReduce(ThreadPool& pool, const SplitIndex<List>& index, T init, BinaryOp op) {
+    std::vector<std::optional<T>> partial(index.GetChunkCount());
+    auto process = [&](size_t chunk) {
+        auto it = index.ChunkBegin(chunk);
+        const auto end = index.ChunkEnd(chunk);
+        T accumulated = *it;
+        for (++it; it != end; ++it) {
+            accumulated = op(std::move(accumulated), *it);
+        }
+        partial[chunk] = std::move(accumulated);
+    };
+    ForEachChunk(pool, index, process);
+
+    for (auto& value : partial) {
+        init = op(std::move(init), std::move(*value));
+    }
+    return init;
+}
+
+template <typename List, typename T, typename BinaryOp>
+T ParallelReduce(ThreadPool& pool, List& list, T init, BinaryOp op) {
+    return ParallelReduce(pool, SplitIndex<List>(list, DefaultSplitStep(list, pool)), std::move(init), std::move(op));
+}
+
+// Возвращает итератор на первый элемент, удовлетворяющий pred, либо end().
+// Фрагменты, лежащие после уже найденного элемента, не просматриваются
+template <typename List, typename Predicate>
+auto ParallelFindIf(ThreadPool& pool, const SplitIndex<List>& index, Predicate pred) {
+    constexpr size_t not_found = static_cast<size_t>(-1);
+    std::atomic<size_t> found_chunk = not_found;
+    std::vector<typename SplitIndex<List>::Iterator> found(index.GetChunkCount());
+    auto process = [&](size_t chunk) {
+        if (chunk > found_chunk.load(std::memory_order_relaxed)) {
+            return;
+        }
+        const auto end = index.ChunkEnd(chunk);
+        const auto it = std::find_if(index.ChunkBegin(chunk), end, pred);
+        if (it == end) {
+            return;
+        }
+        found[chunk] = it;
+        size_t current = found_chunk.load();
+        while (chunk < current && !found_chunk.compare_exchange_weak(current, chunk)) {
+        }
+    };
+    ForEachChunk(pool, index, process);
+
+    const size_t chunk = found_chunk.load();
+    return chunk == not_found ? index.End() : found[chunk];
+}
+
+template <typename List, typename Predicate>
+auto ParallelFindIf(ThreadPool& pool, List& list, Predicate pred) {
+    return ParallelFindIf(pool, SplitIndex<List>(list, DefaultSplitStep(list, pool)), std::move(pred));
+}
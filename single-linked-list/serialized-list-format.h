@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+
+// Формат сохранённого списка: заголовок, за которым подряд в порядке элементов следуют записи.
+// Запись — значение в том же представлении, что и в памяти, без указателей и смещений,
+// поэтому образ не зависит от адреса, по которому он загружен или отображён,
+// и занимает ровно sizeof(Type) на элемент.
+// Числа хранятся в порядке байт той машины, на которой образ записан
+struct SerializedListHeader {
+    static constexpr char kMagic[8] = {'S', 'L', 'L', 'I', 'S', 'T', '\0', '\2'};
+
+    char magic[8] = {};
+    std::uint32_t value_size = 0;
+    std::uint32_t value_alignment = 0;
+    std::uint64_t record_size = 0;
+    std::uint64_t count = 0;
+    // Смещение первой записи от начала образа
+    std::uint64_t first_offset = 0;
+};
+
+// Размещение записей для значений типа Type
+template <typename Type>
+struct SerializedListLayout {
+    static_assert(std::is_trivially_copyable_v<Type>, "only trivially copyable types can be serialized");
+
+    static constexpr std::size_t RoundUp(std::size_t value, std::size_t alignment) noexcept {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    static constexpr std::size_t kRecordSize = sizeof(Type);
+    static constexpr std::size_t kFirstOffset = RoundUp(sizeof(SerializedListHeader), alignof(Type));
+
+    static SerializedListHeader MakeHeader(std::uint64_t count) noexcept {
+        SerializedListHeader header;
+        std::memcpy(header.magic, SerializedListHeader::kMagic, sizeof(header.magic));
+        header.value_size = sizeof(Type);
+        header.value_alignment = alignof(Type);
+        header.record_size = kRecordSize;
+        header.count = count;
+        header.first_offset = kFirstOffset;
+        return header;
+    }
+
+    // Проверяет, что образ с заголовком header записан для значений типа Type.
+    // image_size — размер всего образа либо 0, если он заранее неизвестен
+    static void Validate(const SerializedListHeader& header, std::uint64_t image_size = 0) {
+        if (std::memcmp(header.magic, SerializedListHeader::kMagic, sizeof(header.magic)) != 0) {
+            throw std::runtime_error("not a serialized SingleLinkedList image");
+        }
+        if (header.value_size != sizeof(Type) || header.value_alignment != alignof(Type) || header.record_size != kRecordSize
+            || header.first_offset != kFirstOffset) {
+            throw std::runtime_error("serialized list was written for a different value type");
+        }
+        if (image_size != 0 && header.count > (image_size - std::min<std::uint64_t>(image_size, kFirstOffset)) / kRecordSize) {
+            throw std::runtime_error("serialized list image is truncated");
+        }
+    }
+};
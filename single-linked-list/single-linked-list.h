@@ -1,24 +1,62 @@
+#pragma once
+
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <iostream>
+#include <vector>
+
+#include "list-stats.h"
+#include "serialized-list-format.h"
 
 
-template <typename Type>
+// Если TrackTail равен true, список хранит указатель на последний узел
+// и поддерживает PushBack/EmplaceBack и back() за время O(1).
+// Со стандартным аллокатором список можно строить и изменять в constexpr-функциях (C++20),
+// но узлы не могут пережить вычисление на этапе компиляции: для таблиц,
+// которые должны попасть в исполняемый файл готовыми, есть StaticSingleLinkedList.
+// Stats — политика сбора статистики (см. list-stats.h). По умолчанию статистика не собирается
+// и ничего не стоит; ListStats<> подсчитывает выделения и освобождения узлов, шаги итераторов,
+// копирования списков и сравнения
+template <typename Type, typename Allocator = std::allocator<Type>, bool TrackTail = false, typename Stats = NoListStats>
 class SingleLinkedList {
-    // Узел списка
-    struct Node {
-        Node() = default;
-        Node(const Type& val, Node* next)
-            : value(val)
-            , next_node(next) {
+    struct Node;
+
+    // Связь узла со следующим. Фиктивный узел head_ хранит только её,
+    // поэтому от Type не требуется конструктор по умолчанию
+    struct NodeBase {
+        Node* next_node = nullptr;
+    };
+
+    // Узел списка. Значение конструируется на месте из переданных аргументов
+    struct Node : NodeBase {
+        template <typename... Args>
+        explicit constexpr Node(Node* next, Args&&... args)
+            : NodeBase{next}
+            , value(std::forward<Args>(args)...) {
         }
         Type value;
-        Node* next_node = nullptr;
     };
 
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAllocator>;
+
+    // Количество записей, которые Serialize и Deserialize передают потоку за одно обращение
+    static constexpr size_t kSerializationChunk = 4096;
+
 public:
+    // На сколько узлов упреждающий курсор ForEachPrefetched опережает текущий по умолчанию
+    static constexpr size_t kPrefetchDistance = 8;
 
     template <typename ValueType>
     class BasicIterator {
@@ -26,7 +64,7 @@ public:
         
         
         // Конвертирующий конструктор итератора из указателя на узел списка
-        explicit BasicIterator(Node* node) {
+        explicit constexpr BasicIterator(NodeBase* node) {
             this->node_ = node;
         }
         
@@ -43,25 +81,25 @@ public:
         using reference = ValueType&;
         
         
-        BasicIterator() = default;
+        constexpr BasicIterator() = default;
         
-        BasicIterator(const BasicIterator<Type>& other) noexcept {
+        constexpr BasicIterator(const BasicIterator<Type>& other) noexcept {
            node_ = other.node_;
         }
         
-        BasicIterator& operator=(const BasicIterator& rhs) = default;
+        constexpr BasicIterator& operator=(const BasicIterator& rhs) = default;
         
         // Оператор сравнения итераторов (в роли второго аргумента выступает константный итератор)
         // Два итератора равны, если они ссылаются на один и тот же элемент списка либо на end()
         template<typename T>
-        [[nodiscard]] bool operator==(const BasicIterator<T>& rhs) const noexcept {
+        [[nodiscard]] constexpr bool operator==(const BasicIterator<T>& rhs) const noexcept {
            return node_ == rhs.node_;
         }
 
         // Оператор проверки итераторов на неравенство
         // Противоположен !=
         template<typename T>
-        [[nodiscard]] bool operator!=(const BasicIterator<T>& rhs) const noexcept {
+        [[nodiscard]] constexpr bool operator!=(const BasicIterator<T>& rhs) const noexcept {
             return !(node_ == rhs.node_);
         }
 
@@ -69,8 +107,9 @@ public:
         // Оператор прединкремента. После его вызова итератор указывает на следующий элемент списка
         // Возвращает ссылку на самого себя
         // Инкремент итератора, не указывающего на существующий элемент списка, приводит к неопределённому поведению
-        BasicIterator& operator++() noexcept {
+        constexpr BasicIterator& operator++() noexcept {
             assert(node_ != nullptr);
+            Stats::OnIteratorIncrement();
             node_ = node_->next_node;
               
             return *this;
@@ -80,7 +119,7 @@ public:
         // Возвращает прежнее значение итератора
         // Инкремент итератора, не указывающего на существующий элемент списка,
         // приводит к неопределённому поведению
-        BasicIterator operator++(int) noexcept {
+        constexpr BasicIterator operator++(int) noexcept {
            auto past = *this;
            
            ++(*this);
@@ -91,96 +130,305 @@ public:
         // Операция разыменования. Возвращает ссылку на текущий элемент
         // Вызов этого оператора у итератора, не указывающего на существующий элемент списка,
         // приводит к неопределённому поведению
-        [[nodiscard]] reference operator*() const noexcept {
-            return node_->value;
+        [[nodiscard]] constexpr reference operator*() const noexcept {
+            return static_cast<Node*>(node_)->value;
         }
 
         // Операция доступа к члену класса. Возвращает указатель на текущий элемент списка
         // Вызов этого оператора у итератора, не указывающего на существующий элемент списка,
         // приводит к неопределённому поведению
-        [[nodiscard]] pointer operator->() const noexcept {
-           return &node_->value;
+        [[nodiscard]] constexpr pointer operator->() const noexcept {
+           return &static_cast<Node*>(node_)->value;
         }
 
     private:
-        Node* node_ = nullptr;
+        NodeBase* node_ = nullptr;
     };
         
         
 
-    SingleLinkedList(){
+    constexpr SingleLinkedList(){
         size_ = 0;
     }
 
+    explicit constexpr SingleLinkedList(const Allocator& alloc)
+        : alloc_(alloc) {
+    }
+
     // Возвращает количество элементов в списке за время O(1)
-    [[nodiscard]] size_t GetSize() const noexcept {
+    [[nodiscard]] constexpr size_t GetSize() const noexcept {
        return size_;
     }
 
     // Сообщает, пустой ли список за время O(1)
-    [[nodiscard]] bool IsEmpty() const noexcept {
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept {
        return size_ == 0;
     }
     
-    void PushFront(const Type& value) {
-       head_.next_node = new Node(value, head_.next_node);
+    constexpr void PushFront(const Type& value) {
+       EmplaceFront(value);
+    }
+
+    constexpr void PushFront(Type&& value) {
+       EmplaceFront(std::move(value));
+    }
+
+    // Конструирует элемент в начале списка из аргументов args без промежуточных копий.
+    // Возвращает ссылку на созданный элемент
+    template <typename... Args>
+    constexpr Type& EmplaceFront(Args&&... args) {
+       head_.next_node = CreateNode(head_.next_node, std::forward<Args>(args)...);
        size_++;
+       NoteIfTail(head_.next_node);
+       return head_.next_node->value;
+    }
+
+    constexpr void PushBack(const Type& value) {
+       EmplaceBack(value);
+    }
+
+    constexpr void PushBack(Type&& value) {
+       EmplaceBack(std::move(value));
+    }
+
+    // Конструирует элемент в конце списка за время O(1). Доступно только при TrackTail
+    template <typename... Args>
+    constexpr Type& EmplaceBack(Args&&... args) {
+       static_assert(TrackTail, "EmplaceBack requires TrackTail");
+       return *EmplaceAfter(ConstIterator(LastNode()), std::forward<Args>(args)...);
+    }
+
+    // Первый элемент списка. Список не должен быть пустым
+    [[nodiscard]] constexpr Type& front() noexcept {
+       assert(!IsEmpty());
+       return head_.next_node->value;
+    }
+
+    [[nodiscard]] constexpr const Type& front() const noexcept {
+       assert(!IsEmpty());
+       return head_.next_node->value;
+    }
+
+    // Последний элемент списка за время O(1). Доступно только при TrackTail, список не должен быть пустым
+    [[nodiscard]] constexpr Type& back() noexcept {
+       static_assert(TrackTail, "back() requires TrackTail");
+       assert(!IsEmpty());
+       return tail_->value;
+    }
+
+    [[nodiscard]] constexpr const Type& back() const noexcept {
+       static_assert(TrackTail, "back() requires TrackTail");
+       assert(!IsEmpty());
+       return tail_->value;
     }
 
 
     template<typename T>
-    void CreateLinkedList(T begin, T end){
+    constexpr void CreateLinkedList(T begin, T end){
         size_ = 0;
-        Node* temp_pnt(&head_);
+        NodeBase* temp_pnt(&head_);
         for(auto it = begin; it != end; it++){
-            temp_pnt->next_node = new Node(*it, nullptr);
+            temp_pnt->next_node = CreateNode(nullptr, *it);
             temp_pnt = temp_pnt->next_node;
             size_++;
+            NoteIfTail(temp_pnt);
         }
     }
 
 
-    SingleLinkedList(std::initializer_list<Type> values){
-        SingleLinkedList temp;
+    // Создаёт список из элементов интервала [first, last)
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    constexpr SingleLinkedList(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        : alloc_(alloc) {
+        SingleLinkedList temp(alloc);
+        temp.CreateLinkedList(first, last);
+        swap(temp);
+    }
+
+    constexpr SingleLinkedList(std::initializer_list<Type> values, const Allocator& alloc = Allocator())
+        : alloc_(alloc) {
+        SingleLinkedList temp(alloc);
         temp.CreateLinkedList(values.begin(), values.end());
         swap(temp);
     }
 
-    SingleLinkedList(const SingleLinkedList& other) {
+    constexpr SingleLinkedList(const SingleLinkedList& other)
+        : alloc_(NodeAllocTraits::select_on_container_copy_construction(other.alloc_)) {
+        Stats::OnCopyConstruction();
         if(this != &other){
-            SingleLinkedList temp;
+            SingleLinkedList temp((Allocator(alloc_)));
             temp.CreateLinkedList(other.begin(), other.end());
             swap(temp);
         }
     }
 
-    SingleLinkedList& operator=(const SingleLinkedList& rhs) {
+    // Перемещающий конструктор забирает узлы other за время O(1), other становится пустым
+    constexpr SingleLinkedList(SingleLinkedList&& other) noexcept
+        : alloc_(other.alloc_) {
+        head_.next_node = std::exchange(other.head_.next_node, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        std::swap(tail_, other.tail_);
+    }
+
+    // Копирующее присваивание со строгой гарантией безопасности исключений.
+    // Если элементы присваиваются без исключений, существующие узлы переиспользуются
+    // и память выделяется или освобождается только под разницу длин
+    constexpr SingleLinkedList& operator=(const SingleLinkedList& rhs) {
         if(this != &rhs){
-            auto temp(rhs);
+            if constexpr (NodeAllocTraits::propagate_on_container_copy_assignment::value) {
+                if (!(alloc_ == rhs.alloc_)) {
+                    // Узлы выделяются аллокатором rhs, который станет аллокатором списка.
+                    // swap не годится: без propagate_on_container_swap он оставил бы прежний аллокатор
+                    SingleLinkedList temp((Allocator(rhs.alloc_)));
+                    temp.CreateLinkedList(rhs.begin(), rhs.end());
+                    Clear();
+                    head_.next_node = std::exchange(temp.head_.next_node, nullptr);
+                    size_ = std::exchange(temp.size_, 0);
+                    tail_ = std::exchange(temp.tail_, {});
+                    alloc_ = rhs.alloc_;
+                    return *this;
+                }
+            }
+            AssignStrong(rhs.begin(), rhs.end());
+        }
+        return *this;
+    }
 
-            swap(temp);
+    // Если аллокаторы совместимы, узлы rhs переходят к списку за время O(1).
+    // Иначе элементы перемещаются поэлементно в узлы, выделенные аллокатором списка
+    constexpr SingleLinkedList& operator=(SingleLinkedList&& rhs) noexcept(
+        NodeAllocTraits::propagate_on_container_move_assignment::value || NodeAllocTraits::is_always_equal::value) {
+        if(this != &rhs){
+            Clear();
+            if constexpr (NodeAllocTraits::propagate_on_container_move_assignment::value) {
+                alloc_ = rhs.alloc_;
+            }
+            if (NodeAllocTraits::propagate_on_container_move_assignment::value || alloc_ == rhs.alloc_) {
+                head_.next_node = std::exchange(rhs.head_.next_node, nullptr);
+                size_ = std::exchange(rhs.size_, 0);
+                std::swap(tail_, rhs.tail_);
+            } else {
+                SingleLinkedList temp((Allocator(alloc_)));
+                temp.CreateLinkedList(std::make_move_iterator(rhs.begin()), std::make_move_iterator(rhs.end()));
+                swap(temp);
+                rhs.Clear();
+            }
         }
         return *this;
     }
 
+    /*
+     * Заменяет содержимое списка копиями элементов [first, last).
+     * Значения существующих узлов перезаписываются на месте, новые узлы создаются
+     * только для недостающих элементов, лишние узлы освобождаются.
+     * Для прямых итераторов недостающие узлы создаются заранее одной цепочкой, до изменения списка,
+     * поэтому при присваивании элементов без исключений гарантия строгая.
+     * Иначе гарантия базовая: при исключении список содержит часть новых значений
+     */
+    template <typename InputIt>
+    constexpr void Assign(InputIt first, InputIt last) {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+            InputIt overwrite_end = first;
+            std::advance(overwrite_end, std::min(count, size_));
+            const Chain extra = CreateChain(overwrite_end, last);
+
+            NodeBase* last_kept = &head_;
+            try {
+                for (; first != overwrite_end; ++first) {
+                    last_kept->next_node->value = *first;
+                    last_kept = last_kept->next_node;
+                }
+            } catch (...) {
+                DestroyChain(alloc_, extra.first);
+                throw;
+            }
+            DestroyChain(alloc_, std::exchange(last_kept->next_node, extra.first));
+            size_ = count;
+            NoteIfTail(extra.last != nullptr ? extra.last : last_kept);
+        } else {
+            NodeBase* last_kept = &head_;
+            size_t count = 0;
+            for (; first != last && last_kept->next_node != nullptr; ++first, ++count) {
+                last_kept->next_node->value = *first;
+                last_kept = last_kept->next_node;
+            }
+            const Chain extra = CreateChain(first, last);
+            DestroyChain(alloc_, std::exchange(last_kept->next_node, extra.first));
+            size_ = count + extra.size;
+            NoteIfTail(extra.last != nullptr ? extra.last : last_kept);
+        }
+    }
+
+    constexpr void Assign(std::initializer_list<Type> values) {
+        Assign(values.begin(), values.end());
+    }
+
+    // Заменяет содержимое списка копиями элементов [first, last) со строгой гарантией безопасности исключений.
+    // Узлы переиспользуются, если элементы присваиваются без исключений, иначе список строится заново
+    template <typename InputIt>
+    constexpr void AssignStrong(InputIt first, InputIt last) {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>
+                      && std::is_nothrow_assignable_v<Type&, typename std::iterator_traits<InputIt>::reference>) {
+            Assign(first, last);
+        } else {
+            SingleLinkedList temp((Allocator(alloc_)));
+            temp.CreateLinkedList(first, last);
+            swap(temp);
+        }
+    }
+
     // Обменивает содержимое списков за время O(1)
-    void swap(SingleLinkedList& other) noexcept {
+    constexpr void swap(SingleLinkedList& other) noexcept {
         // auto* temp = other.head_.next_node;
         // other.head_.next_node = head_.next_node;
         // head_.next_node = temp;
         std::swap(head_.next_node, other.head_.next_node);
         std::swap(size_, other.size_);
+        std::swap(tail_, other.tail_);
+        if constexpr (NodeAllocTraits::propagate_on_container_swap::value) {
+            std::swap(alloc_, other.alloc_);
+        }
     }
     
-    void Clear() noexcept {
-        while(head_.next_node != nullptr){
-            EraseAfter(before_begin());
+    // Удаляет все элементы. Цепочка узлов отцепляется от списка целиком,
+    // после чего узлы разрушаются за один проход без обновления head_ и size_ на каждом шаге.
+    // Если элементы тривиально разрушаемы, а все узлы пула принадлежат этому списку,
+    // блоки пула освобождаются целиком без обхода списка
+    constexpr void Clear() noexcept {
+        const size_t count = std::exchange(size_, 0);
+        Node* chain = std::exchange(head_.next_node, nullptr);
+        tail_ = {};
+        if constexpr (std::is_trivially_destructible_v<Type> && HasTryReleaseAll<NodeAllocator>::value) {
+            if (alloc_.TryReleaseAll(count)) {
+                Stats::OnNodesDeallocated(count);
+                return;
+            }
         }
-        
+        DestroyChain(alloc_, chain);
+    }
+
+    // Отцепляет все узлы и передаёт их разрушение фоновому потоку reclaimer
+    // (например, BackgroundReclaimer), так что вызывающий поток возвращается сразу.
+    // Аллокатор должен допускать освобождение памяти из другого потока
+    template <typename Reclaimer>
+    void ClearDeferred(Reclaimer& reclaimer) {
+        static_assert(NodeAllocTraits::is_always_equal::value,
+                      "deferred reclamation requires a stateless thread-safe allocator");
+        if (head_.next_node == nullptr) {
+            return;
+        }
+        reclaimer.Submit([alloc = alloc_, chain = head_.next_node]() mutable {
+            DestroyChain(alloc, chain);
+        });
+        head_.next_node = nullptr;
         size_ = 0;
+        tail_ = {};
     }
     
-    ~SingleLinkedList(){
+    constexpr ~SingleLinkedList(){
         Clear();
     }
     
@@ -188,6 +436,12 @@ public:
     using value_type = Type;
     using reference = value_type&;
     using const_reference = const value_type&;
+    using allocator_type = Allocator;
+
+    // Возвращает копию аллокатора, которым пользуется список
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return allocator_type(alloc_);
+    }
 
     // Итератор, допускающий изменение элементов списка
     using Iterator = BasicIterator<Type>;
@@ -196,14 +450,14 @@ public:
 
     // Возвращает итератор, ссылающийся на первый элемент
     // Если список пустой, возвращённый итератор будет равен end()
-    [[nodiscard]] Iterator begin() noexcept {
+    [[nodiscard]] constexpr Iterator begin() noexcept {
         Iterator begin(head_.next_node);
         return begin;
     }
 
     // Возвращает итератор, указывающий на позицию, следующую за последним элементом односвязного списка
     // Разыменовывать этот итератор нельзя — попытка разыменования приведёт к неопределённому поведению
-    [[nodiscard]] Iterator end() noexcept {
+    [[nodiscard]] constexpr Iterator end() noexcept {
         Iterator end(nullptr);
         
         return end;
@@ -212,7 +466,7 @@ public:
     // Возвращает константный итератор, ссылающийся на первый элемент
     // Если список пустой, возвращённый итератор будет равен end()
     // Результат вызова эквивалентен вызову метода cbegin()
-    [[nodiscard]] ConstIterator begin() const noexcept {
+    [[nodiscard]] constexpr ConstIterator begin() const noexcept {
         ConstIterator  begin(head_.next_node);
         return begin;
     }
@@ -220,7 +474,7 @@ public:
     // Возвращает константный итератор, указывающий на позицию, следующую за последним элементом односвязного списка
     // Разыменовывать этот итератор нельзя — попытка разыменования приведёт к неопределённому поведению
     // Результат вызова эквивалентен вызову метода cend()
-    [[nodiscard]] ConstIterator end() const noexcept {
+    [[nodiscard]] constexpr ConstIterator end() const noexcept {
         ConstIterator  end(nullptr);
         
         return end;
@@ -228,34 +482,34 @@ public:
 
     // Возвращает константный итератор, ссылающийся на первый элемент
     // Если список пустой, возвращённый итератор будет равен cend()
-    [[nodiscard]] ConstIterator cbegin() const noexcept {
+    [[nodiscard]] constexpr ConstIterator cbegin() const noexcept {
        ConstIterator  begin(head_.next_node);
         return begin;
     }
 
     // Возвращает константный итератор, указывающий на позицию, следующую за последним элементом односвязного списка
     // Разыменовывать этот итератор нельзя — попытка разыменования приведёт к неопределённому поведению
-    [[nodiscard]] ConstIterator cend() const noexcept {
+    [[nodiscard]] constexpr ConstIterator cend() const noexcept {
         ConstIterator  end;
         
         return end;
     }
     
-    [[nodiscard]] Iterator before_begin() noexcept {
+    [[nodiscard]] constexpr Iterator before_begin() noexcept {
         //Node* temp = &head
         return Iterator(&head_);
     }
 
     // Возвращает константный итератор, указывающий на позицию перед первым элементом односвязного списка.
     // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
-    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
-        return ConstIterator(const_cast<Node*>(&head_));
+    [[nodiscard]] constexpr ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator(const_cast<NodeBase*>(&head_));
     }
 
     // Возвращает константный итератор, указывающий на позицию перед первым элементом односвязного списка.
     // Разыменовывать этот итератор нельзя - попытка разыменования приведёт к неопределённому поведению
-    [[nodiscard]] ConstIterator before_begin() const noexcept {
-        return ConstIterator(&head_);
+    [[nodiscard]] constexpr ConstIterator before_begin() const noexcept {
+        return ConstIterator(const_cast<NodeBase*>(&head_));
     }
 
     /*
@@ -263,10 +517,25 @@ public:
      * Возвращает итератор на вставленный элемент
      * Если при создании элемента будет выброшено исключение, список останется в прежнем состоянии
      */
-    Iterator InsertAfter(ConstIterator pos, const Type& value) {
-        Node* node = new Node(value, pos.node_->next_node);
+    constexpr Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    constexpr Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return EmplaceAfter(pos, std::move(value));
+    }
+
+    /*
+     * Конструирует элемент из аргументов args непосредственно в новом узле после pos.
+     * Возвращает итератор на вставленный элемент
+     * Если при создании элемента будет выброшено исключение, список останется в прежнем состоянии
+     */
+    template <typename... Args>
+    constexpr Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        Node* node = CreateNode(pos.node_->next_node, std::forward<Args>(args)...);
         pos.node_->next_node = node;
         size_++;
+        NoteIfTail(node);
         return Iterator(node);
     }
 
@@ -276,57 +545,661 @@ public:
      * Удаляет элемент, следующий за pos.
      * Возвращает итератор на элемент, следующий за удалённым
      */
-    Iterator EraseAfter(ConstIterator pos) noexcept {
-        delete std::exchange(pos.node_->next_node, pos.node_->next_node->next_node);
+    constexpr Iterator EraseAfter(ConstIterator pos) noexcept {
+        DestroyNode(std::exchange(pos.node_->next_node, pos.node_->next_node->next_node));
         size_--;
+        NoteIfTail(pos.node_);
         return Iterator(pos.node_->next_node);
     }
 
-    void PopFront() noexcept {
+    constexpr void PopFront() noexcept {
         EraseAfter(before_begin());
     }
 
+    /*
+     * Вставляет копии элементов [first, last) после pos.
+     * Цепочка узлов строится отдельно и присоединяется к списку за один шаг, поэтому
+     * при исключении список остаётся в прежнем состоянии.
+     * Возвращает итератор на последний вставленный элемент либо pos, если интервал пуст
+     */
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    constexpr Iterator InsertAfter(ConstIterator pos, InputIt first, InputIt last) {
+        const Chain chain = CreateChain(first, last);
+        if (chain.first == nullptr) {
+            return Iterator(pos.node_);
+        }
+        chain.last->next_node = pos.node_->next_node;
+        pos.node_->next_node = chain.first;
+        size_ += chain.size;
+        NoteIfTail(chain.last);
+        return Iterator(chain.last);
+    }
+
+    constexpr Iterator InsertAfter(ConstIterator pos, std::initializer_list<Type> values) {
+        return InsertAfter(pos, values.begin(), values.end());
+    }
+
+    /*
+     * Удаляет элементы интервала (first, last).
+     * Возвращает итератор last
+     */
+    constexpr Iterator EraseAfter(ConstIterator first, ConstIterator last) noexcept {
+        Node* const stop = static_cast<Node*>(last.node_);
+        Node* erased = std::exchange(first.node_->next_node, stop);
+        size_t count = 0;
+        if constexpr (kReleasesChains) {
+            if (erased != stop) {
+                Node* erased_last = erased;
+                for (count = 1; erased_last->next_node != stop; ++count) {
+                    erased_last = erased_last->next_node;
+                }
+                erased_last->next_node = nullptr;
+                ReleaseChain(erased, erased_last, count);
+            }
+        } else {
+            while (erased != stop) {
+                DestroyNode(std::exchange(erased, erased->next_node));
+                ++count;
+            }
+        }
+        size_ -= count;
+        NoteIfTail(first.node_);
+        return Iterator(last.node_);
+    }
+
+    /*
+     * Удаляет все элементы, для которых pred возвращает true, за один проход.
+     * pred не должен ссылаться на элементы списка: удалённые элементы могут разрушаться сразу
+     * (для удаления элементов, равных одному из элементов списка, есть Remove).
+     * Если pred выбросит исключение, уже отобранные элементы удаляются, остальные остаются.
+     * Возвращает количество удалённых элементов
+     */
+    template <typename Predicate>
+    constexpr size_t RemoveIf(Predicate pred) {
+        return RemoveAfterEach(&head_, [&pred](const NodeBase*, const Node* node) {
+            return static_cast<bool>(pred(node->value));
+        });
+    }
+
+    // Удаляет все элементы, равные value, которое может быть одним из элементов списка.
+    // Возвращает количество удалённых элементов
+    constexpr size_t Remove(const Type& value) {
+        return RemoveAfterEach(
+            &head_,
+            [&value](const NodeBase*, const Node* node) {
+                return static_cast<bool>(node->value == value);
+            },
+            &value);
+    }
+
+    /*
+     * Оставляет из каждой группы подряд идущих элементов, для которых pred(первый, очередной)
+     * возвращает true, только первый. Возвращает количество удалённых элементов
+     */
+    template <typename BinaryPredicate = std::equal_to<>>
+    constexpr size_t Unique(BinaryPredicate pred = BinaryPredicate()) {
+        if (size_ < 2) {
+            return 0;
+        }
+        return RemoveAfterEach(head_.next_node, [&pred](const NodeBase* kept, const Node* node) {
+            return static_cast<bool>(pred(static_cast<const Node*>(kept)->value, node->value));
+        });
+    }
+
+    /*
+     * Вызывает function для каждого элемента по порядку.
+     * Вместе с текущим узлом обход ведёт упреждающий курсор, опережающий его на distance узлов:
+     * узлы, до которых дошёл упреждающий курсор, заранее запрашиваются в кеш.
+     * Упреждающий курсор сам переходит по next_node, поэтому выигрыш ограничен тем,
+     * насколько его загрузки перекрываются с работой над текущими узлами
+     */
+    template <typename Function>
+    constexpr void ForEachPrefetched(Function function, size_t distance = kPrefetchDistance) {
+        FindNode(head_.next_node, distance, [&function](Node* node) {
+            function(node->value);
+            return false;
+        });
+    }
+
+    template <typename Function>
+    constexpr void ForEachPrefetched(Function function, size_t distance = kPrefetchDistance) const {
+        FindNode(head_.next_node, distance, [&function](const Node* node) {
+            function(node->value);
+            return false;
+        });
+    }
+
+    // Возвращает итератор на первый элемент, равный value, либо end(). Обход как в ForEachPrefetched
+    [[nodiscard]] constexpr Iterator Find(const Type& value, size_t distance = kPrefetchDistance) {
+        return Iterator(FindNode(head_.next_node, distance, [&value](const Node* node) {
+            return node->value == value;
+        }));
+    }
+
+    [[nodiscard]] constexpr ConstIterator Find(const Type& value, size_t distance = kPrefetchDistance) const {
+        return ConstIterator(FindNode(head_.next_node, distance, [&value](const Node* node) {
+            return node->value == value;
+        }));
+    }
+
+    // Возвращает количество элементов, равных value. Обход как в ForEachPrefetched
+    [[nodiscard]] constexpr size_t Count(const Type& value, size_t distance = kPrefetchDistance) const {
+        size_t count = 0;
+        ForEachPrefetched(
+            [&count, &value](const Type& element) {
+                count += element == value ? 1 : 0;
+            },
+            distance);
+        return count;
+    }
+
+    // Сворачивает элементы слева направо: init = op(init, элемент). Обход как в ForEachPrefetched
+    template <typename Result, typename BinaryOperation = std::plus<>>
+    [[nodiscard]] constexpr Result Accumulate(Result init, BinaryOperation op = BinaryOperation(),
+                                              size_t distance = kPrefetchDistance) const {
+        ForEachPrefetched(
+            [&init, &op](const Type& element) {
+                init = op(std::move(init), element);
+            },
+            distance);
+        return init;
+    }
+
+    /*
+     * Возвращает итераторы на первую пару элементов этого списка и other, для которой pred
+     * возвращает false. Если один из списков закончился раньше, соответствующий итератор равен end().
+     * Оба списка обходятся, как в ForEachPrefetched
+     */
+    template <typename BinaryPredicate = std::equal_to<>>
+    [[nodiscard]] constexpr std::pair<ConstIterator, ConstIterator> Mismatch(
+        const SingleLinkedList& other, BinaryPredicate pred = BinaryPredicate(), size_t distance = kPrefetchDistance) const {
+        PrefetchingCursor lhs(head_.next_node, distance);
+        PrefetchingCursor rhs(other.head_.next_node, distance);
+        while (lhs.Get() != nullptr && rhs.Get() != nullptr && pred(lhs.Get()->value, rhs.Get()->value)) {
+            lhs.Advance();
+            rhs.Advance();
+        }
+        return {ConstIterator(lhs.Get()), ConstIterator(rhs.Get())};
+    }
+
+    /*
+     * Устойчиво сортирует список слиянием снизу вверх за время O(n log n).
+     * Узлы только перецепляются, дополнительная память не выделяется,
+     * итераторы и ссылки на элементы остаются действительными
+     */
+    template <typename Compare = std::less<>>
+    constexpr void Sort(Compare comp = Compare()) {
+        if (size_ < 2) {
+            return;
+        }
+
+        // bins[i] хранит отсортированную цепочку из 2^i узлов либо nullptr.
+        // Цепочки в старших ячейках состоят из более ранних элементов
+        Node* bins[64] = {};
+        size_t used_bins = 0;
+        Node* node = head_.next_node;
+        while (node != nullptr) {
+            Node* run = std::exchange(node, node->next_node);
+            run->next_node = nullptr;
+            size_t i = 0;
+            for (; bins[i] != nullptr; ++i) {
+                run = MergeChains(std::exchange(bins[i], nullptr), run, comp);
+            }
+            bins[i] = run;
+            used_bins = std::max(used_bins, i + 1);
+        }
+
+        Node* result = nullptr;
+        for (size_t i = 0; i < used_bins; ++i) {
+            if (bins[i] != nullptr) {
+                result = result == nullptr ? bins[i] : MergeChains(bins[i], result, comp);
+            }
+        }
+        head_.next_node = result;
+        if constexpr (TrackTail) {
+            while (result->next_node != nullptr) {
+                result = result->next_node;
+            }
+            tail_ = result;
+        }
+    }
+
+    /*
+     * Сливает отсортированный список other в текущий отсортированный список.
+     * Узлы other перецепляются без копирования, other становится пустым.
+     * При равенстве элементы текущего списка идут раньше элементов other
+     */
+    template <typename Compare = std::less<>>
+    constexpr void Merge(SingleLinkedList& other, Compare comp = Compare()) {
+        if (this == &other) {
+            return;
+        }
+        assert(alloc_ == other.alloc_);
+        head_.next_node = MergeChains(head_.next_node, std::exchange(other.head_.next_node, nullptr), comp);
+        size_ += std::exchange(other.size_, 0);
+        // Последним оказывается последний узел одного из списков
+        if constexpr (TrackTail) {
+            Node* other_tail = std::exchange(other.tail_, nullptr);
+            if (other_tail != nullptr && other_tail->next_node == nullptr) {
+                tail_ = other_tail;
+            }
+        }
+    }
+
+    template <typename Compare = std::less<>>
+    constexpr void Merge(SingleLinkedList&& other, Compare comp = Compare()) {
+        Merge(other, comp);
+    }
+
+    // Переносит все элементы other после pos. other становится пустым
+    constexpr void SpliceAfter(ConstIterator pos, SingleLinkedList& other) noexcept {
+        if (other.IsEmpty()) {
+            return;
+        }
+        NodeBase* last = &other.head_;
+        if constexpr (TrackTail) {
+            last = other.tail_;
+        } else {
+            while (last->next_node != nullptr) {
+                last = last->next_node;
+            }
+        }
+        TransferAfter(pos, other, other.cbefore_begin(), ConstIterator(last), other.size_);
+    }
+
+    constexpr void SpliceAfter(ConstIterator pos, SingleLinkedList&& other) noexcept {
+        SpliceAfter(pos, other);
+    }
+
+    // Переносит элемент, следующий за it в списке other, на позицию после pos
+    constexpr void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator it) noexcept {
+        if (pos == it || pos.node_ == it.node_->next_node) {
+            return;
+        }
+        TransferAfter(pos, other, it, ConstIterator(it.node_->next_node), 1);
+    }
+
+    constexpr void SpliceAfter(ConstIterator pos, SingleLinkedList&& other, ConstIterator it) noexcept {
+        SpliceAfter(pos, other, it);
+    }
+
+    // Переносит элементы интервала (first, last) списка other на позицию после pos.
+    // pos не должен лежать внутри переносимого интервала
+    constexpr void SpliceAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator first, ConstIterator last) noexcept {
+        NodeBase* before_last = first.node_;
+        size_t count = 0;
+        while (before_last->next_node != last.node_) {
+            before_last = before_last->next_node;
+            ++count;
+        }
+        if (count != 0) {
+            TransferAfter(pos, other, first, ConstIterator(before_last), count);
+        }
+    }
+
+    constexpr void SpliceAfter(ConstIterator pos, SingleLinkedList&& other, ConstIterator first, ConstIterator last) noexcept {
+        SpliceAfter(pos, other, first, last);
+    }
+
+    /*
+     * Записывает список в output непрерывным образом в формате serialized-list-format.h:
+     * записи идут подряд в порядке элементов. Доступно для тривиально копируемых Type.
+     * При ошибке записи выбрасывает std::runtime_error
+     */
+    void Serialize(std::ostream& output) const {
+        using Layout = SerializedListLayout<Type>;
+
+        const SerializedListHeader header = Layout::MakeHeader(size_);
+        std::vector<char> buffer(Layout::kFirstOffset);
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        buffer.assign(kSerializationChunk * Layout::kRecordSize, 0);
+        size_t written = 0;
+        size_t buffered = 0;
+        for (const Node* node = head_.next_node; node != nullptr; node = node->next_node) {
+            std::memcpy(buffer.data() + buffered * Layout::kRecordSize, &node->value, sizeof(Type));
+            ++written;
+            if (++buffered == kSerializationChunk || written == size_) {
+                output.write(buffer.data(), static_cast<std::streamsize>(buffered * Layout::kRecordSize));
+                buffered = 0;
+            }
+        }
+        if (!output) {
+            throw std::runtime_error("failed to write serialized list");
+        }
+    }
+
+    /*
+     * Восстанавливает список, записанный Serialize, читая input блоками.
+     * Узлы создаются аллокатором alloc в порядке записей.
+     * Если образ повреждён, обрезан или записан для другого типа, выбрасывает std::runtime_error
+     */
+    static SingleLinkedList Deserialize(std::istream& input, const Allocator& alloc = Allocator()) {
+        using Layout = SerializedListLayout<Type>;
+
+        std::vector<char> buffer(Layout::kFirstOffset);
+        if (!input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+            throw std::runtime_error("serialized list header is truncated");
+        }
+        SerializedListHeader header;
+        std::memcpy(&header, buffer.data(), sizeof(header));
+        Layout::Validate(header);
+
+        SingleLinkedList result(alloc);
+        NodeBase* tail = &result.head_;
+        buffer.resize(kSerializationChunk * Layout::kRecordSize);
+        for (uint64_t remaining = header.count; remaining != 0;) {
+            const size_t chunk = static_cast<size_t>(std::min<uint64_t>(remaining, kSerializationChunk));
+            if (!input.read(buffer.data(), static_cast<std::streamsize>(chunk * Layout::kRecordSize))) {
+                throw std::runtime_error("serialized list image is truncated");
+            }
+            for (size_t i = 0; i < chunk; ++i) {
+                alignas(Type) std::byte value[sizeof(Type)];
+                std::memcpy(value, buffer.data() + i * Layout::kRecordSize, sizeof(Type));
+                tail->next_node = result.CreateNode(nullptr, *std::launder(reinterpret_cast<Type*>(value)));
+                tail = tail->next_node;
+                ++result.size_;
+            }
+            remaining -= chunk;
+        }
+        result.NoteIfTail(tail);
+        return result;
+    }
+
 private:
+    // Выделяет память под узел через аллокатор списка и конструирует в нём значение из args.
+    // Если конструктор значения выбросит исключение, память будет возвращена аллокатору
+    template <typename... Args>
+    constexpr Node* CreateNode(Node* next, Args&&... args) {
+        Node* node = NodeAllocTraits::allocate(alloc_, 1);
+        try {
+            NodeAllocTraits::construct(alloc_, node, next, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeAllocTraits::deallocate(alloc_, node, 1);
+            throw;
+        }
+        Stats::OnNodesAllocated(1);
+        return node;
+    }
+
+    // Отдельная цепочка узлов, ещё не присоединённая к списку
+    struct Chain {
+        Node* first = nullptr;
+        Node* last = nullptr;
+        size_t size = 0;
+    };
+
+    // Создаёт цепочку узлов с копиями элементов [first, last), завершающуюся nullptr.
+    // Если создание элемента выбросит исключение, уже созданные узлы будут освобождены
+    template <typename InputIt>
+    constexpr Chain CreateChain(InputIt first, InputIt last) {
+        Chain chain;
+        NodeBase head;
+        NodeBase* tail = &head;
+        try {
+            for (; first != last; ++first) {
+                tail->next_node = CreateNode(nullptr, *first);
+                tail = tail->next_node;
+                ++chain.size;
+            }
+        } catch (...) {
+            DestroyChain(alloc_, head.next_node);
+            throw;
+        }
+        chain.first = head.next_node;
+        chain.last = chain.size == 0 ? nullptr : static_cast<Node*>(tail);
+        return chain;
+    }
+
+    // Переносит count узлов после first по last включительно из other на позицию после pos
+    constexpr void TransferAfter(ConstIterator pos, SingleLinkedList& other, ConstIterator first, ConstIterator last, size_t count) noexcept {
+        assert(alloc_ == other.alloc_);
+        Node* moved = first.node_->next_node;
+        first.node_->next_node = last.node_->next_node;
+        last.node_->next_node = pos.node_->next_node;
+        pos.node_->next_node = moved;
+        other.size_ -= count;
+        size_ += count;
+        other.NoteIfTail(first.node_);
+        NoteIfTail(last.node_);
+    }
+
+    // Сливает две отсортированные цепочки узлов, завершающиеся nullptr.
+    // При равенстве первым идёт узел из lhs
+    template <typename Compare>
+    static constexpr Node* MergeChains(Node* lhs, Node* rhs, Compare& comp) {
+        NodeBase merged;
+        NodeBase* tail = &merged;
+        while (lhs != nullptr && rhs != nullptr) {
+            if (comp(rhs->value, lhs->value)) {
+                tail->next_node = std::exchange(rhs, rhs->next_node);
+            } else {
+                tail->next_node = std::exchange(lhs, lhs->next_node);
+            }
+            tail = tail->next_node;
+        }
+        tail->next_node = lhs != nullptr ? lhs : rhs;
+        return merged.next_node;
+    }
+
+    // Подсказывает процессору заранее загрузить узел в кеш. На результат не влияет
+    static constexpr void Prefetch(const NodeBase* node) noexcept {
+#if defined(__GNUC__)
+        if (!std::is_constant_evaluated()) {
+            __builtin_prefetch(node);
+        }
+#else
+        (void)node;
+#endif
+    }
+
+    // Курсор обхода узлов, за которым на distance узлов впереди идёт упреждающий курсор.
+    // Каждый узел, до которого доходит упреждающий курсор, запрашивается в кеш,
+    // и к тому времени, как до него дойдёт основной курсор, загрузка уже завершена или идёт
+    class PrefetchingCursor {
+    public:
+        constexpr PrefetchingCursor(Node* first, size_t distance) noexcept
+            : node_(first)
+            , ahead_(first) {
+            for (; distance != 0 && ahead_ != nullptr; --distance) {
+                ahead_ = ahead_->next_node;
+                Prefetch(ahead_);
+            }
+        }
+
+        [[nodiscard]] constexpr Node* Get() const noexcept {
+            return node_;
+        }
+
+        constexpr void Advance() noexcept {
+            Stats::OnIteratorIncrement();
+            node_ = node_->next_node;
+            if (ahead_ != nullptr) {
+                ahead_ = ahead_->next_node;
+                Prefetch(ahead_);
+            }
+        }
+
+    private:
+        Node* node_;
+        Node* ahead_;
+    };
+
+    // Возвращает первый узел цепочки first, для которого pred возвращает true, либо nullptr
+    template <typename Predicate>
+    static constexpr Node* FindNode(Node* first, size_t distance, Predicate pred) {
+        PrefetchingCursor cursor(first, distance);
+        while (cursor.Get() != nullptr && !pred(cursor.Get())) {
+            cursor.Advance();
+        }
+        return cursor.Get();
+    }
+
+    // Проходит узлы после start и удаляет те, для которых should_remove(последний оставленный, узел)
+    // возвращает true, обновляя size_ один раз. Если аллокатор принимает цепочки, удалённые узлы
+    // освобождаются одной цепочкой после прохода. Иначе узлы разрушаются сразу, пока они в кеше,
+    // и откладывается только узел со значением по адресу alias, на которое может ссылаться should_remove
+    template <typename ShouldRemove>
+    constexpr size_t RemoveAfterEach(NodeBase* start, ShouldRemove should_remove, const Type* alias = nullptr) {
+        NodeBase deferred;
+        NodeBase* deferred_last = &deferred;
+        size_t deferred_count = 0;
+        size_t count = 0;
+        NodeBase* kept = start;
+        const auto finish = [&] {
+            size_ -= count;
+            if (deferred_count != 0) {
+                deferred_last->next_node = nullptr;
+                ReleaseChain(deferred.next_node, static_cast<Node*>(deferred_last), deferred_count);
+            }
+        };
+        try {
+            while (Node* node = kept->next_node) {
+                if (!should_remove(std::as_const(kept), std::as_const(node))) {
+                    kept = node;
+                    continue;
+                }
+                kept->next_node = node->next_node;
+                ++count;
+                if (kReleasesChains || &node->value == alias) {
+                    deferred_last->next_node = node;
+                    deferred_last = node;
+                    ++deferred_count;
+                } else {
+                    DestroyNode(node);
+                }
+            }
+        } catch (...) {
+            finish();
+            throw;
+        }
+        finish();
+        NoteIfTail(kept);
+        return count;
+    }
+
+    // Освобождает отцепленную цепочку из count узлов от first до last, завершающуюся nullptr.
+    // При kReleasesChains цепочка целиком возвращается в список свободных аллокатора без обхода
+    constexpr void ReleaseChain(Node* first, Node* last, size_t count) noexcept {
+        if constexpr (kReleasesChains) {
+            alloc_.DeallocateChain(first, last, count);
+            Stats::OnNodesDeallocated(count);
+        } else {
+            (void)last;
+            (void)count;
+            DestroyChain(alloc_, first);
+        }
+    }
+
+    // Запоминает node как последний узел, если за ним ничего нет
+    constexpr void NoteIfTail(NodeBase* node) noexcept {
+        if constexpr (TrackTail) {
+            if (node->next_node == nullptr) {
+                tail_ = node == &head_ ? nullptr : static_cast<Node*>(node);
+            }
+        }
+    }
+
+    // Последний узел списка либо фиктивный узел, если список пуст
+    constexpr NodeBase* LastNode() noexcept {
+        if (tail_ == nullptr) {
+            return &head_;
+        }
+        return tail_;
+    }
+
+    constexpr void DestroyNode(Node* node) noexcept {
+        NodeAllocTraits::destroy(alloc_, node);
+        NodeAllocTraits::deallocate(alloc_, node, 1);
+        Stats::OnNodesDeallocated(1);
+    }
+
+    // Разрушает цепочку узлов, завершающуюся nullptr
+    static constexpr void DestroyChain(NodeAllocator& alloc, Node* node) noexcept {
+        size_t count = 0;
+        while (node != nullptr) {
+            Node* next = node->next_node;
+            NodeAllocTraits::destroy(alloc, node);
+            NodeAllocTraits::deallocate(alloc, node, 1);
+            node = next;
+            ++count;
+        }
+        Stats::OnNodesDeallocated(count);
+    }
+
+    // Есть ли у аллокатора массовое освобождение TryReleaseAll (см. PoolAllocator)
+    template <typename Alloc, typename = void>
+    struct HasTryReleaseAll : std::false_type {};
+
+    template <typename Alloc>
+    struct HasTryReleaseAll<Alloc, std::void_t<decltype(std::declval<Alloc&>().TryReleaseAll(size_t{}))>>
+        : std::true_type {};
+
+    // Может ли аллокатор принять цепочку узлов целиком (см. PoolAllocator::DeallocateChain)
+    template <typename Alloc, typename = void>
+    struct HasDeallocateChain : std::false_type {};
+
+    template <typename Alloc>
+    struct HasDeallocateChain<Alloc, std::void_t<decltype(std::declval<Alloc&>().DeallocateChain(
+                                         std::declval<Node*>(), std::declval<Node*>(), size_t{}))>>
+        : std::true_type {};
+
+    // Можно ли освобождать цепочки узлов целиком, не разрушая значения по одному.
+    // Узлы цепочки связаны через next_node, лежащий в начале узла, как того требует DeallocateChain
+    static constexpr bool kReleasesChains = std::is_trivially_destructible_v<Type> && HasDeallocateChain<NodeAllocator>::value;
+
     // Фиктивный узел, используется для вставки "перед первым элементом"
-    Node head_;
+    NodeBase head_;
     size_t size_ = 0;
+    struct NoTail {};
+    // Последний узел (nullptr для пустого списка). Хранится только при TrackTail
+    [[no_unique_address]] std::conditional_t<TrackTail, Node*, NoTail> tail_{};
+    NodeAllocator alloc_;
 };
 
 
-template <typename Type>
-void swap(SingleLinkedList<Type>& lhs, SingleLinkedList<Type>& rhs) noexcept {
+template <typename Type, typename Allocator, bool TrackTail, typename Stats>
+constexpr void swap(SingleLinkedList<Type, Allocator, TrackTail, Stats>& lhs, SingleLinkedList<Type, Allocator, TrackTail, Stats>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
-template <typename Type>
-bool operator==(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator, bool TrackTail, typename Stats>
+constexpr bool operator==(const SingleLinkedList<Type, Allocator, TrackTail, Stats>& lhs, const SingleLinkedList<Type, Allocator, TrackTail, Stats>& rhs) {
     
-    return (lhs.GetSize() == rhs.GetSize()) && std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    Stats::OnComparison();
+    // При равных размерах списки заканчиваются одновременно
+    return (lhs.GetSize() == rhs.GetSize()) && lhs.Mismatch(rhs).first == lhs.end();
 }
 
-template <typename Type>
-bool operator!=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator, bool TrackTail, typename Stats>
+constexpr bool operator!=(const SingleLinkedList<Type, Allocator, TrackTail, Stats>& lhs, const SingleLinkedList<Type, Allocator, TrackTail, Stats>& rhs) {
 
     return !(lhs == rhs);
 }
 
-template <typename Type>
-bool operator<(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+template <typename Type, typename Allocator, bool TrackTail, typename Stats>
+constexpr bool operator<(const SingleLinkedList<Type, Allocator, TrackTail, Stats>& lhs, const SingleLinkedList<Type, Allocator, TrackTail, Stats>& rhs) {
+    Stats::OnComparison();
+    // Как и std::lexicographical_compare, сравнивает элементы только оператором <
+    const auto [lhs_it, rhs_it] = lhs.Mismatch(rhs, [](const Type& lhs_value, const Type& rhs_value) {
+        return !(lhs_value < rhs_value) && !(rhs_value < lhs_value);
+    });
+    return rhs_it != rhs.end() && (lhs_it == lhs.end() || *lhs_it < *rhs_it);
 }
 
-template <typename Type>
-bool operator<=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator, bool TrackTail, typename Stats>
+constexpr bool operator<=(const SingleLinkedList<Type, Allocator, TrackTail, Stats>& lhs, const SingleLinkedList<Type, Allocator, TrackTail, Stats>& rhs) {
     return !(lhs > rhs) ;
 }
 
-template <typename Type>
-bool operator>(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator, bool TrackTail, typename Stats>
+constexpr bool operator>(const SingleLinkedList<Type, Allocator, TrackTail, Stats>& lhs, const SingleLinkedList<Type, Allocator, TrackTail, Stats>& rhs) {
     return rhs < lhs;
 }
 
-template <typename Type>
-bool operator>=(const SingleLinkedList<Type>& lhs, const SingleLinkedList<Type>& rhs) {
+template <typename Type, typename Allocator, bool TrackTail, typename Stats>
+constexpr bool operator>=(const SingleLinkedList<Type, Allocator, TrackTail, Stats>& lhs, const SingleLinkedList<Type, Allocator, TrackTail, Stats>& rhs) {
     return (rhs < lhs) || (lhs == rhs);
 } 
 
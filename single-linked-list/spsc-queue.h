@@ -0,0 +1,200 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+
+
+// Неограниченная очередь для одного производителя и одного потребителя.
+// Устроена как односвязный список с фиктивным первым узлом, аналогичным head_ в SingleLinkedList:
+// потребитель читает значение из узла, следующего за фиктивным, и делает этот узел новым фиктивным,
+// а производитель дописывает узлы в конец. Каждая сторона меняет только свой указатель,
+// поэтому Push и TryPop не ждут друг друга и обходятся без compare_exchange.
+// Узлы, пройденные потребителем, не освобождаются, а переиспользуются производителем,
+// так что в установившемся режиме очередь не выделяет память.
+// Push/PushRange/Emplace можно вызывать только из одного потока, TryPop/PopBatch — только из другого
+template <typename Type>
+class SpscQueue {
+    struct Node {
+        // Значение хранится в сырой памяти: у фиктивного и закэшированных узлов его нет
+        Type* GetValue() noexcept {
+            return std::launder(reinterpret_cast<Type*>(&storage));
+        }
+
+        std::atomic<Node*> next_node{nullptr};
+        alignas(Type) std::byte storage[sizeof(Type)];
+    };
+
+public:
+    // Размер строки кэша, по которому разнесены данные производителя и потребителя
+    static constexpr std::size_t kCacheLineSize = 64;
+
+    SpscQueue()
+        : producer_{new Node} {
+        producer_.first = producer_.last;
+        producer_.consumer_position = producer_.last;
+        consumer_.dummy.store(producer_.last, std::memory_order_relaxed);
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Разрушение очереди не должно выполняться одновременно с другими операциями над ней
+    ~SpscQueue() {
+        Node* const dummy = consumer_.dummy.load(std::memory_order_acquire);
+        bool has_value = false;
+        Node* node = producer_.first;
+        while (node != nullptr) {
+            Node* next = node->next_node.load(std::memory_order_relaxed);
+            if (has_value) {
+                node->GetValue()->~Type();
+            }
+            has_value = has_value || node == dummy;
+            delete node;
+            node = next;
+        }
+    }
+
+    // Вызывается только потребителем
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return consumer_.dummy.load(std::memory_order_relaxed)->next_node.load(std::memory_order_acquire) == nullptr;
+    }
+
+    void Push(const Type& value) {
+        Emplace(value);
+    }
+
+    void Push(Type&& value) {
+        Emplace(std::move(value));
+    }
+
+    template <typename... Args>
+    void Emplace(Args&&... args) {
+        Node* node = CreateNode(std::forward<Args>(args)...);
+        producer_.last->next_node.store(node, std::memory_order_release);
+        producer_.last = node;
+    }
+
+    /*
+     * Добавляет элементы [first, last) в конец очереди.
+     * Потребитель получает их одной публикацией, а не по одному.
+     * Если конструирование элемента выбросит исключение, предшествующие ему элементы
+     * остаются в очереди
+     */
+    template <typename InputIt>
+    void PushRange(InputIt first, InputIt last) {
+        Node* chain_first = nullptr;
+        Node* chain_last = nullptr;
+        try {
+            for (; first != last; ++first) {
+                Node* node = CreateNode(*first);
+                if (chain_last == nullptr) {
+                    chain_first = node;
+                } else {
+                    chain_last->next_node.store(node, std::memory_order_relaxed);
+                }
+                chain_last = node;
+            }
+        } catch (...) {
+            PublishChain(chain_first, chain_last);
+            throw;
+        }
+        PublishChain(chain_first, chain_last);
+    }
+
+    // Извлекает первый элемент в value. Возвращает false, если очередь пуста
+    bool TryPop(Type& value) {
+        Node* const dummy = consumer_.dummy.load(std::memory_order_relaxed);
+        Node* const next = dummy->next_node.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        value = std::move(*next->GetValue());
+        next->GetValue()->~Type();
+        consumer_.dummy.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /*
+     * Извлекает не более max_count элементов в out.
+     * Прочитанные узлы возвращаются производителю одной записью после обработки всей пачки.
+     * Если запись в out выбросит исключение, уже извлечённые элементы из очереди удаляются,
+     * а элемент, на котором произошло исключение, и следующие за ним остаются в ней.
+     * Возвращает количество извлечённых элементов
+     */
+    template <typename OutputIt>
+    std::size_t PopBatch(OutputIt out, std::size_t max_count) {
+        Node* dummy = consumer_.dummy.load(std::memory_order_relaxed);
+        std::size_t count = 0;
+        try {
+            for (; count < max_count; ++count) {
+                Node* const next = dummy->next_node.load(std::memory_order_acquire);
+                if (next == nullptr) {
+                    break;
+                }
+                *out = std::move(*next->GetValue());
+                next->GetValue()->~Type();
+                dummy = next;
+                ++out;
+            }
+        } catch (...) {
+            consumer_.dummy.store(dummy, std::memory_order_release);
+            throw;
+        }
+        consumer_.dummy.store(dummy, std::memory_order_release);
+        return count;
+    }
+
+private:
+    // Возвращает узел со сконструированным значением.
+    // Сначала берётся узел, уже пройденный потребителем, и только если таких нет — выделяется новый
+    template <typename... Args>
+    Node* CreateNode(Args&&... args) {
+        if (producer_.first == producer_.consumer_position) {
+            producer_.consumer_position = consumer_.dummy.load(std::memory_order_acquire);
+        }
+        if (producer_.first != producer_.consumer_position) {
+            Node* node = producer_.first;
+            // Пока значение не сконструировано, узел остаётся в кэше: при исключении ничего не меняется
+            new (&node->storage) Type(std::forward<Args>(args)...);
+            producer_.first = node->next_node.load(std::memory_order_relaxed);
+            node->next_node.store(nullptr, std::memory_order_relaxed);
+            return node;
+        }
+
+        Node* node = new Node;
+        try {
+            new (&node->storage) Type(std::forward<Args>(args)...);
+        } catch (...) {
+            delete node;
+            throw;
+        }
+        return node;
+    }
+
+    void PublishChain(Node* chain_first, Node* chain_last) noexcept {
+        if (chain_first != nullptr) {
+            producer_.last->next_node.store(chain_first, std::memory_order_release);
+            producer_.last = chain_last;
+        }
+    }
+
+    // Данные производителя. Узлы от first до consumer_position уже пройдены потребителем
+    // и могут быть переиспользованы
+    struct alignas(kCacheLineSize) ProducerSide {
+        Node* last = nullptr;
+        Node* first = nullptr;
+        // Последнее прочитанное значение consumer_.dummy: обновляется, только когда кэш исчерпан
+        Node* consumer_position = nullptr;
+    };
+
+    // Данные потребителя: текущий фиктивный узел, за которым начинаются элементы очереди
+    struct alignas(kCacheLineSize) ConsumerSide {
+        std::atomic<Node*> dummy{nullptr};
+    };
+
+    ProducerSide producer_;
+    ConsumerSide consumer_;
+};
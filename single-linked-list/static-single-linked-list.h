@@ -0,0 +1,317 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+// Односвязный список фиксированной ёмкости Capacity с узлами внутри самого объекта.
+// Память не выделяется, все операции constexpr, поэтому список можно полностью построить
+// на этапе компиляции и поместить в constexpr-переменную, которая попадёт в данные только для чтения:
+//     static constexpr StaticSingleLinkedList<int, 4> kTable = {1, 2, 3};
+// Узлы связаны индексами, а не указателями, поэтому копия списка не требует перецепления узлов.
+// Свободные ячейки хранят сконструированные по умолчанию значения,
+// так что Type должен быть конструируемым по умолчанию и присваиваемым.
+// Вставка в заполненный список выбрасывает std::length_error
+template <typename Type, size_t Capacity>
+class StaticSingleLinkedList {
+    static_assert(Capacity > 0, "StaticSingleLinkedList requires a positive capacity");
+
+    // Индекс, обозначающий отсутствие узла
+    static constexpr size_t kNone = Capacity;
+    // Индекс фиктивного узла, используется итератором "перед первым элементом"
+    static constexpr size_t kHead = Capacity + 1;
+
+    struct Node {
+        Type value{};
+        size_t next_node = kNone;
+    };
+
+public:
+
+    template <typename ValueType>
+    class BasicIterator {
+        friend class StaticSingleLinkedList;
+
+        using ListPointer = std::conditional_t<std::is_const_v<ValueType>, const StaticSingleLinkedList*, StaticSingleLinkedList*>;
+
+        constexpr BasicIterator(ListPointer list, size_t node) noexcept
+            : list_(list)
+            , node_(node) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        constexpr BasicIterator() = default;
+
+        constexpr BasicIterator(const BasicIterator<Type>& other) noexcept
+            : list_(other.list_)
+            , node_(other.node_) {
+        }
+
+        constexpr BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        template <typename T>
+        [[nodiscard]] constexpr bool operator==(const BasicIterator<T>& rhs) const noexcept {
+            return node_ == rhs.node_;
+        }
+
+        template <typename T>
+        [[nodiscard]] constexpr bool operator!=(const BasicIterator<T>& rhs) const noexcept {
+            return !(node_ == rhs.node_);
+        }
+
+        constexpr BasicIterator& operator++() noexcept {
+            assert(node_ != kNone);
+            node_ = list_->NextOf(node_);
+            return *this;
+        }
+
+        constexpr BasicIterator operator++(int) noexcept {
+            auto past = *this;
+            ++(*this);
+            return past;
+        }
+
+        [[nodiscard]] constexpr reference operator*() const noexcept {
+            return list_->nodes_[node_].value;
+        }
+
+        [[nodiscard]] constexpr pointer operator->() const noexcept {
+            return &list_->nodes_[node_].value;
+        }
+
+    private:
+        ListPointer list_ = nullptr;
+        size_t node_ = kNone;
+    };
+
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    constexpr StaticSingleLinkedList() = default;
+
+    // Создаёт список из элементов интервала [first, last)
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    constexpr StaticSingleLinkedList(InputIt first, InputIt last) {
+        ConstIterator pos = cbefore_begin();
+        for (; first != last; ++first) {
+            pos = InsertAfter(pos, *first);
+        }
+    }
+
+    constexpr StaticSingleLinkedList(std::initializer_list<Type> values)
+        : StaticSingleLinkedList(values.begin(), values.end()) {
+    }
+
+    [[nodiscard]] constexpr size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] static constexpr size_t GetCapacity() noexcept {
+        return Capacity;
+    }
+
+    constexpr void PushFront(const Type& value) {
+        InsertAfter(cbefore_begin(), value);
+    }
+
+    constexpr void PushFront(Type&& value) {
+        InsertAfter(cbefore_begin(), std::move(value));
+    }
+
+    template <typename... Args>
+    constexpr Type& EmplaceFront(Args&&... args) {
+        return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+    }
+
+    // Первый элемент списка. Список не должен быть пустым
+    [[nodiscard]] constexpr Type& front() noexcept {
+        assert(!IsEmpty());
+        return nodes_[head_].value;
+    }
+
+    [[nodiscard]] constexpr const Type& front() const noexcept {
+        assert(!IsEmpty());
+        return nodes_[head_].value;
+    }
+
+    constexpr void swap(StaticSingleLinkedList& other) noexcept(std::is_nothrow_swappable_v<Type>) {
+        std::swap(nodes_, other.nodes_);
+        std::swap(head_, other.head_);
+        std::swap(free_, other.free_);
+        std::swap(used_, other.used_);
+        std::swap(size_, other.size_);
+    }
+
+    // Удаляет все элементы, возвращая ячейкам значения по умолчанию
+    constexpr void Clear() {
+        for (size_t i = 0; i < used_; ++i) {
+            nodes_[i] = Node{};
+        }
+        head_ = kNone;
+        free_ = kNone;
+        used_ = 0;
+        size_ = 0;
+    }
+
+    [[nodiscard]] constexpr Iterator begin() noexcept {
+        return Iterator(this, head_);
+    }
+
+    [[nodiscard]] constexpr Iterator end() noexcept {
+        return Iterator(this, kNone);
+    }
+
+    [[nodiscard]] constexpr ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] constexpr ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] constexpr ConstIterator cbegin() const noexcept {
+        return ConstIterator(this, head_);
+    }
+
+    [[nodiscard]] constexpr ConstIterator cend() const noexcept {
+        return ConstIterator(this, kNone);
+    }
+
+    [[nodiscard]] constexpr Iterator before_begin() noexcept {
+        return Iterator(this, kHead);
+    }
+
+    [[nodiscard]] constexpr ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] constexpr ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator(this, kHead);
+    }
+
+    constexpr Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    constexpr Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return EmplaceAfter(pos, std::move(value));
+    }
+
+    /*
+     * Записывает элемент, построенный из args, в свободную ячейку и вставляет его после pos.
+     * Возвращает итератор на вставленный элемент.
+     * Если список заполнен или построение элемента выбросит исключение, список не изменится
+     */
+    template <typename... Args>
+    constexpr Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        if (size_ == Capacity) {
+            throw std::length_error("StaticSingleLinkedList capacity exceeded");
+        }
+        const size_t node = free_ != kNone ? free_ : used_;
+        nodes_[node].value = Type(std::forward<Args>(args)...);
+        if (node == free_) {
+            free_ = nodes_[node].next_node;
+        } else {
+            ++used_;
+        }
+        size_t& link = LinkAfter(pos.node_);
+        nodes_[node].next_node = link;
+        link = node;
+        ++size_;
+        return Iterator(this, node);
+    }
+
+    /*
+     * Удаляет элемент, следующий за pos, и возвращает его ячейку в список свободных.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    constexpr Iterator EraseAfter(ConstIterator pos) {
+        size_t& link = LinkAfter(pos.node_);
+        const size_t erased = link;
+        link = nodes_[erased].next_node;
+        nodes_[erased].value = Type{};
+        nodes_[erased].next_node = free_;
+        free_ = erased;
+        --size_;
+        return Iterator(this, link);
+    }
+
+    constexpr void PopFront() {
+        EraseAfter(cbefore_begin());
+    }
+
+private:
+    [[nodiscard]] constexpr size_t NextOf(size_t node) const noexcept {
+        return node == kHead ? head_ : nodes_[node].next_node;
+    }
+
+    // Ссылка на индекс узла, следующего за node (для фиктивного узла — на head_)
+    [[nodiscard]] constexpr size_t& LinkAfter(size_t node) noexcept {
+        return node == kHead ? head_ : nodes_[node].next_node;
+    }
+
+    Node nodes_[Capacity] = {};
+    // Индекс первого узла
+    size_t head_ = kNone;
+    // Начало списка освобождённых ячеек, связанных через next_node
+    size_t free_ = kNone;
+    // Количество ячеек, хотя бы раз выданных под узлы: ячейки начиная с used_ ещё не использовались
+    size_t used_ = 0;
+    size_t size_ = 0;
+};
+
+
+template <typename Type, size_t Capacity>
+constexpr void swap(StaticSingleLinkedList<Type, Capacity>& lhs, StaticSingleLinkedList<Type, Capacity>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+template <typename Type, size_t Capacity>
+constexpr bool operator==(const StaticSingleLinkedList<Type, Capacity>& lhs, const StaticSingleLinkedList<Type, Capacity>& rhs) {
+    return (lhs.GetSize() == rhs.GetSize()) && std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t Capacity>
+constexpr bool operator!=(const StaticSingleLinkedList<Type, Capacity>& lhs, const StaticSingleLinkedList<Type, Capacity>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t Capacity>
+constexpr bool operator<(const StaticSingleLinkedList<Type, Capacity>& lhs, const StaticSingleLinkedList<Type, Capacity>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t Capacity>
+constexpr bool operator<=(const StaticSingleLinkedList<Type, Capacity>& lhs, const StaticSingleLinkedList<Type, Capacity>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t Capacity>
+constexpr bool operator>(const StaticSingleLinkedList<Type, Capacity>& lhs, const StaticSingleLinkedList<Type, Capacity>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t Capacity>
+constexpr bool operator>=(const StaticSingleLinkedList<Type, Capacity>& lhs, const StaticSingleLinkedList<Type, Capacity>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+// Пул потоков фиксированного размера с общей очередью задач
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t thread_count = std::thread::hardware_concurrency()) {
+        if (thread_count == 0) {
+            thread_count = 1;
+        }
+        workers_.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i) {
+            workers_.emplace_back([this] {
+                Run();
+            });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Дожидается выполнения всех поставленных задач и останавливает потоки
+    ~ThreadPool() {
+        {
+            std::lock_guard guard(mutex_);
+            stopping_ = true;
+        }
+        has_work_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    [[nodiscard]] size_t GetThreadCount() const noexcept {
+        return workers_.size();
+    }
+
+    // Выполняется ли вызывающий код в одном из потоков этого пула
+    [[nodiscard]] bool IsWorkerThread() const noexcept {
+        return current_pool_ == this;
+    }
+
+    // Ставит задачу в очередь. Результат или исключение задачи доступны через future
+    template <typename Function>
+    auto Submit(Function function) -> std::future<decltype(function())> {
+        auto task = std::make_shared<std::packaged_task<decltype(function())()>>(std::move(function));
+        auto result = task->get_future();
+        {
+            std::lock_guard guard(mutex_);
+            tasks_.emplace_back([task] {
+                (*task)();
+            });
+        }
+        has_work_.notify_one();
+        return result;
+    }
+
+private:
+    void Run() {
+        current_pool_ = this;
+        std::unique_lock lock(mutex_);
+        while (true) {
+            has_work_.wait(lock, [this] {
+                return stopping_ || !tasks_.empty();
+            });
+            if (tasks_.empty()) {
+                return;
+            }
+            std::function<void()> task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    // Пул, которому принадлежит текущий поток, либо nullptr
+    static inline thread_local const ThreadPool* current_pool_ = nullptr;
+
+    std::mutex mutex_;
+    std::condition_variable has_work_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+};
@@ -0,0 +1,435 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+// Развёрнутый односвязный список: каждый узел (блок) хранит до ChunkSize элементов подряд.
+// Интерфейс повторяет SingleLinkedList (before_begin, InsertAfter, EraseAfter, PopFront и т.д.),
+// но при обходе указатель на следующий узел загружается один раз на ChunkSize элементов.
+//
+// В отличие от SingleLinkedList вставка и удаление сдвигают элементы внутри блока,
+// поэтому после InsertAfter действительными остаются только возвращённый итератор
+// и итераторы на элементы других блоков. EraseAfter, кроме того, может слить блок удалённого
+// элемента со следующим, поэтому после него недействительны и итераторы на элементы следующего блока.
+// Элементы переносятся между позициями перемещающим конструктором, который не должен выбрасывать исключений.
+// Вставка даёт строгую гарантию безопасности исключений
+template <typename Type, size_t ChunkSize = 16>
+class UnrolledSingleLinkedList {
+    static_assert(ChunkSize > 0, "ChunkSize must be positive");
+    static_assert(std::is_nothrow_move_constructible_v<Type>, "Type must be nothrow move constructible");
+
+    struct Chunk;
+
+    // Заголовок блока. Фиктивный блок head_ всегда пуст
+    struct ChunkBase {
+        Chunk* next_chunk = nullptr;
+        size_t count = 0;
+    };
+
+    // Блок с неинициализированным хранилищем под ChunkSize элементов.
+    // Проинициализированы только первые count элементов
+    struct Chunk : ChunkBase {
+        Type* Data(size_t index) noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage + index * sizeof(Type)));
+        }
+
+        alignas(Type) std::byte storage[sizeof(Type) * ChunkSize];
+    };
+
+public:
+
+    template <typename ValueType>
+    class BasicIterator {
+        friend class UnrolledSingleLinkedList;
+
+        BasicIterator(ChunkBase* chunk, size_t index) noexcept
+            : chunk_(chunk)
+            , index_(index) {
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ValueType*;
+        using reference = ValueType&;
+
+        BasicIterator() = default;
+
+        BasicIterator(const BasicIterator<Type>& other) noexcept
+            : chunk_(other.chunk_)
+            , index_(other.index_) {
+        }
+
+        BasicIterator& operator=(const BasicIterator& rhs) = default;
+
+        template <typename T>
+        [[nodiscard]] bool operator==(const BasicIterator<T>& rhs) const noexcept {
+            return chunk_ == rhs.chunk_ && index_ == rhs.index_;
+        }
+
+        template <typename T>
+        [[nodiscard]] bool operator!=(const BasicIterator<T>& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
+        // Переходит к следующему элементу блока, а после последнего — к началу следующего блока.
+        // Фиктивный блок пуст, поэтому из before_begin() итератор сразу попадает на первый элемент
+        BasicIterator& operator++() noexcept {
+            assert(chunk_ != nullptr);
+            if (++index_ >= chunk_->count) {
+                chunk_ = chunk_->next_chunk;
+                index_ = 0;
+            }
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            auto past = *this;
+            ++(*this);
+            return past;
+        }
+
+        [[nodiscard]] reference operator*() const noexcept {
+            return *static_cast<Chunk*>(chunk_)->Data(index_);
+        }
+
+        [[nodiscard]] pointer operator->() const noexcept {
+            return static_cast<Chunk*>(chunk_)->Data(index_);
+        }
+
+    private:
+        ChunkBase* chunk_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    using value_type = Type;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    using Iterator = BasicIterator<Type>;
+    using ConstIterator = BasicIterator<const Type>;
+
+    UnrolledSingleLinkedList() = default;
+
+    UnrolledSingleLinkedList(std::initializer_list<Type> values) {
+        CreateLinkedList(values.begin(), values.end());
+    }
+
+    UnrolledSingleLinkedList(const UnrolledSingleLinkedList& other) {
+        CreateLinkedList(other.begin(), other.end());
+    }
+
+    UnrolledSingleLinkedList(UnrolledSingleLinkedList&& other) noexcept {
+        swap(other);
+    }
+
+    UnrolledSingleLinkedList& operator=(const UnrolledSingleLinkedList& rhs) {
+        if (this != &rhs) {
+            auto temp(rhs);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    UnrolledSingleLinkedList& operator=(UnrolledSingleLinkedList&& rhs) noexcept {
+        if (this != &rhs) {
+            Clear();
+            swap(rhs);
+        }
+        return *this;
+    }
+
+    ~UnrolledSingleLinkedList() {
+        Clear();
+    }
+
+    // Заполняет пустой список копиями элементов [begin, end), плотно упаковывая блоки
+    template <typename T>
+    void CreateLinkedList(T begin, T end) {
+        assert(IsEmpty());
+        ChunkBase* tail = &head_;
+        try {
+            for (auto it = begin; it != end; ++it) {
+                if (tail == &head_ || tail->count == ChunkSize) {
+                    tail = LinkNewChunk(tail);
+                }
+                Chunk* chunk = static_cast<Chunk*>(tail);
+                new (chunk->Data(chunk->count)) Type(*it);
+                ++chunk->count;
+                ++size_;
+            }
+        } catch (...) {
+            Clear();
+            throw;
+        }
+    }
+
+    [[nodiscard]] size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    void PushFront(const Type& value) {
+        EmplaceAfter(cbefore_begin(), value);
+    }
+
+    void PushFront(Type&& value) {
+        EmplaceAfter(cbefore_begin(), std::move(value));
+    }
+
+    template <typename... Args>
+    Type& EmplaceFront(Args&&... args) {
+        return *EmplaceAfter(cbefore_begin(), std::forward<Args>(args)...);
+    }
+
+    void swap(UnrolledSingleLinkedList& other) noexcept {
+        std::swap(head_.next_chunk, other.head_.next_chunk);
+        std::swap(size_, other.size_);
+    }
+
+    void Clear() noexcept {
+        Chunk* chunk = std::exchange(head_.next_chunk, nullptr);
+        while (chunk != nullptr) {
+            DestroyChunk(std::exchange(chunk, chunk->next_chunk));
+        }
+        size_ = 0;
+    }
+
+    [[nodiscard]] Iterator begin() noexcept {
+        return Iterator(head_.next_chunk, 0);
+    }
+
+    [[nodiscard]] Iterator end() noexcept {
+        return Iterator(nullptr, 0);
+    }
+
+    [[nodiscard]] ConstIterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] ConstIterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] ConstIterator cbegin() const noexcept {
+        return ConstIterator(head_.next_chunk, 0);
+    }
+
+    [[nodiscard]] ConstIterator cend() const noexcept {
+        return ConstIterator(nullptr, 0);
+    }
+
+    [[nodiscard]] Iterator before_begin() noexcept {
+        return Iterator(&head_, 0);
+    }
+
+    [[nodiscard]] ConstIterator before_begin() const noexcept {
+        return cbefore_begin();
+    }
+
+    [[nodiscard]] ConstIterator cbefore_begin() const noexcept {
+        return ConstIterator(const_cast<ChunkBase*>(&head_), 0);
+    }
+
+    Iterator InsertAfter(ConstIterator pos, const Type& value) {
+        return EmplaceAfter(pos, value);
+    }
+
+    Iterator InsertAfter(ConstIterator pos, Type&& value) {
+        return EmplaceAfter(pos, std::move(value));
+    }
+
+    /*
+     * Конструирует элемент из args прямо в его позиции после pos.
+     * Если блок заполнен, он делится пополам. Элементы блока сдвигаются до конструирования,
+     * поэтому args не должны ссылаться на элементы этого списка.
+     * При исключении список остаётся в прежнем состоянии.
+     * Возвращает итератор на вставленный элемент
+     */
+    template <typename... Args>
+    Iterator EmplaceAfter(ConstIterator pos, Args&&... args) {
+        ChunkBase* chunk = pos.chunk_;
+        size_t index = pos.index_ + 1;
+        // Созданный для вставки блок и блок, после которого он стоит
+        ChunkBase* fresh_prev = nullptr;
+        bool split = false;
+        if (chunk == &head_) {
+            if (head_.next_chunk == nullptr || head_.next_chunk->count == ChunkSize) {
+                LinkNewChunk(&head_);
+                fresh_prev = &head_;
+            }
+            chunk = head_.next_chunk;
+            index = 0;
+        } else if (chunk->count == ChunkSize) {
+            Chunk* fresh = LinkNewChunk(chunk);
+            fresh_prev = chunk;
+            if (index == ChunkSize) {
+                // Вставка за последним элементом заполненного блока: новый блок
+                // начинается со вставленного элемента, последовательные вставки заполнят его целиком
+                chunk = fresh;
+                index = 0;
+            } else {
+                const size_t half = ChunkSize / 2;
+                MoveElements(static_cast<Chunk*>(chunk), half, fresh);
+                split = true;
+                if (index > half) {
+                    chunk = fresh;
+                    index -= half;
+                }
+            }
+        }
+
+        Chunk* target = static_cast<Chunk*>(chunk);
+        ShiftRight(target, index);
+        try {
+            new (target->Data(index)) Type(std::forward<Args>(args)...);
+        } catch (...) {
+            ShiftLeft(target, index);
+            if (fresh_prev != nullptr) {
+                Chunk* fresh = fresh_prev->next_chunk;
+                if (split) {
+                    MoveElements(fresh, 0, static_cast<Chunk*>(fresh_prev));
+                }
+                fresh_prev->next_chunk = fresh->next_chunk;
+                DestroyChunk(fresh);
+            }
+            throw;
+        }
+        ++target->count;
+        ++size_;
+        return Iterator(target, index);
+    }
+
+    /*
+     * Удаляет элемент, следующий за pos.
+     * Опустевший блок освобождается, а малозаполненный объединяется со следующим.
+     * Возвращает итератор на элемент, следующий за удалённым
+     */
+    Iterator EraseAfter(ConstIterator pos) noexcept {
+        ConstIterator erased = pos;
+        ++erased;
+        Chunk* chunk = static_cast<Chunk*>(erased.chunk_);
+        const size_t index = erased.index_;
+
+        chunk->Data(index)->~Type();
+        --chunk->count;
+        ShiftLeft(chunk, index);
+        --size_;
+
+        if (chunk->count == 0) {
+            // Элемент был единственным в блоке, значит pos указывает на предыдущий блок
+            pos.chunk_->next_chunk = chunk->next_chunk;
+            DestroyChunk(chunk);
+            return Iterator(pos.chunk_->next_chunk, 0);
+        }
+
+        Chunk* next = chunk->next_chunk;
+        if (next != nullptr && chunk->count < ChunkSize / 2 && chunk->count + next->count <= ChunkSize) {
+            MoveElements(next, 0, chunk);
+            chunk->next_chunk = next->next_chunk;
+            DestroyChunk(next);
+        }
+
+        if (index < chunk->count) {
+            return Iterator(chunk, index);
+        }
+        return Iterator(chunk->next_chunk, 0);
+    }
+
+    void PopFront() noexcept {
+        EraseAfter(cbefore_begin());
+    }
+
+private:
+    // Создаёт пустой блок и вставляет его после prev
+    Chunk* LinkNewChunk(ChunkBase* prev) {
+        Chunk* chunk = new Chunk();
+        chunk->next_chunk = prev->next_chunk;
+        prev->next_chunk = chunk;
+        return chunk;
+    }
+
+    static void DestroyChunk(Chunk* chunk) noexcept {
+        for (size_t i = 0; i < chunk->count; ++i) {
+            chunk->Data(i)->~Type();
+        }
+        delete chunk;
+    }
+
+    // Переносит элементы from[first, count) в конец блока to
+    static void MoveElements(Chunk* from, size_t first, Chunk* to) noexcept {
+        for (size_t i = first; i < from->count; ++i) {
+            new (to->Data(to->count)) Type(std::move(*from->Data(i)));
+            from->Data(i)->~Type();
+            ++to->count;
+        }
+        from->count = first;
+    }
+
+    // Освобождает позицию index, сдвигая элементы [index, count) на одну позицию вправо
+    static void ShiftRight(Chunk* chunk, size_t index) noexcept {
+        for (size_t i = chunk->count; i > index; --i) {
+            new (chunk->Data(i)) Type(std::move(*chunk->Data(i - 1)));
+            chunk->Data(i - 1)->~Type();
+        }
+    }
+
+    // Закрывает свободную позицию index, сдвигая элементы [index + 1, count] на одну позицию влево
+    static void ShiftLeft(Chunk* chunk, size_t index) noexcept {
+        for (size_t i = index; i < chunk->count; ++i) {
+            new (chunk->Data(i)) Type(std::move(*chunk->Data(i + 1)));
+            chunk->Data(i + 1)->~Type();
+        }
+    }
+
+    // Фиктивный пустой блок, используется для вставки "перед первым элементом"
+    ChunkBase head_;
+    size_t size_ = 0;
+};
+
+
+template <typename Type, size_t ChunkSize>
+void swap(UnrolledSingleLinkedList<Type, ChunkSize>& lhs, UnrolledSingleLinkedList<Type, ChunkSize>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, size_t ChunkSize>
+bool operator==(const UnrolledSingleLinkedList<Type, ChunkSize>& lhs, const UnrolledSingleLinkedList<Type, ChunkSize>& rhs) {
+    return (lhs.GetSize() == rhs.GetSize()) && std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t ChunkSize>
+bool operator!=(const UnrolledSingleLinkedList<Type, ChunkSize>& lhs, const UnrolledSingleLinkedList<Type, ChunkSize>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t ChunkSize>
+bool operator<(const UnrolledSingleLinkedList<Type, ChunkSize>& lhs, const UnrolledSingleLinkedList<Type, ChunkSize>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t ChunkSize>
+bool operator<=(const UnrolledSingleLinkedList<Type, ChunkSize>& lhs, const UnrolledSingleLinkedList<Type, ChunkSize>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t ChunkSize>
+bool operator>(const UnrolledSingleLinkedList<Type, ChunkSize>& lhs, const UnrolledSingleLinkedList<Type, ChunkSize>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t ChunkSize>
+bool operator>=(const UnrolledSingleLinkedList<Type, ChunkSize>& lhs, const UnrolledSingleLinkedList<Type, ChunkSize>& rhs) {
+    return !(lhs < rhs);
+}